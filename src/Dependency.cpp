@@ -70,34 +70,44 @@ void Dependency::setNULL() {
 	// transfer/inverse transfer function associated with the connector.
 	TF = &SmartDG::TransferFunctionsIdealConnector::Instance001::TF;
 	FT = &SmartDG::TransferFunctionsIdealConnector::Instance001::FT;
-	// Sets GUIConnection to null
-	con = NULL;
+	id = 0;
+	direction = 0;
+}
+
+unsigned int Dependency::FromValue() {
+	return 2 * id;
+}
+
+unsigned int Dependency::ToValue() {
+	return 2 * id + 1;
 }
 
 void Dependency::Display() {
 	// Displays full URLs
 	// {Connector} Source URL - DependencyObject -> Target URL
-	cout << "{" << Name << "}" << From.str << "----" << From.stro << "---->"
-			<< To.str << endl;
+	cout << "{" << Name << "}" << From.str() << "----" << From.stro() << "---->"
+			<< To.str() << endl;
 }
 
 void Dependency::DisplayMini() {
 	// Displays {Connector}
 	// Source DependencyNode . Source DependencyPort - DependencyObject -> Target DependencyNode . Target DependencyPort
-	cout << "{" << Name << "}" << From.strn << "." << From.strp << "-"
-			<< From.stro << "->" << To.strn << "." << To.strp << endl;
+	cout << "{" << Name << "}" << From.strn() << "." << From.strp() << "-"
+			<< From.stro() << "->" << To.strn() << "." << To.strp() << endl;
 }
 
 void Dependency::DisplayValues(vector<DependencyNode> &DN) {
 	// Displays full URLs with Values
 	// {Connector} Source URL{Source DependencyDataPackage} ---- DependencyObject ----> Target URL{Target DependencyDataPackage}
 	DependencyDataPackage FROMVAL =
-			DN[From.NodeIndex].DP[From.InOutIndex][From.PortIndex].DO[From.ObjectIndex].udi[To.str];
+			DN[From.NodeIndex].DP[From.InOutIndex][From.PortIndex].DO[From.ObjectIndex].Get(
+					To.str());
 	DependencyDataPackage TOVAL =
-			DN[To.NodeIndex].DP[To.InOutIndex][To.PortIndex].DO[To.ObjectIndex].udi[From.str];
+			DN[To.NodeIndex].DP[To.InOutIndex][To.PortIndex].DO[To.ObjectIndex].Get(
+					From.str());
 
-	cout << "{" << Name << "}" << From.str << "{" << FROMVAL << "}" << "----"
-			<< From.stro << "---->" << "{" << TOVAL << "}" << To.str << endl;
+	cout << "{" << Name << "}" << From.str() << "{" << FROMVAL << "}" << "----"
+			<< From.stro() << "---->" << "{" << TOVAL << "}" << To.str() << endl;
 }
 
 Dependency::~Dependency() {
@@ -32,7 +32,8 @@ public:
 	URL From;		///< Source Dependency URL
 	URL To;			///< Target Dependency URL
 	bool errorflag;	///< Set to true when InOutIndex for either of the two URLs is wrong
-	GUIConnection *con;	///< Points to GUIConnection object that materializes this dependency
+	unsigned int id;	///< Dense index of this dependency in its DependencyGraph (set by DependencyGraph::AddDependency)
+	int direction;	///< Direction of the last call by DependencyGraph::Solve() (1 : TF, -1 : FT, 0 : not called), applied to its GUIConnection by every DependencyMonitor
 	//////////////////////////////////////////////////
 	/// \fn Dependency()
 	/// \brief Constructor
@@ -114,8 +115,8 @@ public:
 	/// \brief Function pointer to connector's transfer function
 	///
 	/// By default this is assigned to point to &SmartDG::TransferFunctionsIdealConnector::Instance001::TF\n
-	/// In case the connector is a dependency node, this function pointer is later assigned to
-	/// transfer function associated with the connector.
+	/// DependencyGraph::AddDependency() assigns the transfer function registered for the connector
+	/// type (Dependency::Name) with DependencyConnector::Register(). NULL is skipped by the solver.
 	///
 	/// \param [in, out] SourcePorts
 	/// \param [in, out] TargetPorts
@@ -130,8 +131,8 @@ public:
 	/// \brief Function pointer to connector's inverse transfer function
 	///
 	/// By default this is assigned to point to &SmartDG::TransferFunctionsIdealConnector::Instance001::FT\n
-	/// In case the connector is a dependency node, this function pointer is later assigned to
-	/// inverse transfer function associated with the connector.
+	/// DependencyGraph::AddDependency() assigns the inverse transfer function registered for the connector
+	/// type (Dependency::Name) with DependencyConnector::Register(). NULL is skipped by the solver.
 	///
 	/// \param [in, out] SourcePorts
 	/// \param [in, out] TargetPorts
@@ -144,12 +145,24 @@ public:
 	/// \fn void setNULL()
 	///
 	/// - Sets Transfer/Inverse transfer Function pointers to ideal connector's Transfer/Inverse transfer Functions\n
-	/// - Sets GUIConnection con to null
+	/// - Sets id and direction to 0
 	///
-	/// \brief Sets default values for TF, FT and con pointers
+	/// \brief Sets default values for TF and FT pointers
 	//////////////////////////////////////////////////
 	void setNULL();
 	//////////////////////////////////////////////////
+	/// \fn unsigned int FromValue()
+	/// \brief Returns value id (2 * id) of the Source udi in DependencyDataBuffer of the parent DependencyGraph
+	/// \see ToValue()
+	//////////////////////////////////////////////////
+	unsigned int FromValue();
+	//////////////////////////////////////////////////
+	/// \fn unsigned int ToValue()
+	/// \brief Returns value id (2 * id + 1) of the Target udi in DependencyDataBuffer of the parent DependencyGraph
+	/// \see FromValue()
+	//////////////////////////////////////////////////
+	unsigned int ToValue();
+	//////////////////////////////////////////////////
 	/// \fn void Display()
 	/// \brief Display function
 	///
@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyComponent.cpp
+/// \brief	Source file for DependencyComponent class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+
+DependencyComponent::DependencyComponent() {
+	TFT = NULL;
+	TF = NULL;
+	FT = NULL;
+	List = NULL;
+	HTF = NULL;
+	HFT = NULL;
+}
+
+DependencyComponent::DependencyComponent(SFPT tft) {
+	TFT = tft;
+	TF = NULL;
+	FT = NULL;
+	List = NULL;
+	HTF = NULL;
+	HFT = NULL;
+}
+
+DependencyComponent::DependencyComponent(SCFPT tf, SCFPT ft, SLFPT list) {
+	TFT = NULL;
+	TF = tf;
+	FT = ft;
+	List = list;
+	HTF = NULL;
+	HFT = NULL;
+}
+
+DependencyComponent::DependencyComponent(SHFPT htf, SHFPT hft, SLFPT list,
+		const vector<string> &bindings) {
+	TFT = NULL;
+	TF = NULL;
+	FT = NULL;
+	List = list;
+	HTF = htf;
+	HFT = hft;
+	Bindings = bindings;
+}
+
+void DependencyComponent::CallTF(vector<vector<DependencyPort> > &DP,
+		const vector<URL> &Handles) {
+	if (HTF) {
+		HTF(DP, Handles);
+		return;
+	}
+	if (TF) {
+		TF(DP);
+		return;
+	}
+	// Adapter, Return keeps its capacity between calls (one per solving thread)
+	if (TFT) {
+		static thread_local vector<string> Return;
+		Return.clear();
+		TFT("TF", Return, DP);
+	}
+}
+
+void DependencyComponent::CallFT(vector<vector<DependencyPort> > &DP,
+		const vector<URL> &Handles) {
+	if (HFT) {
+		HFT(DP, Handles);
+		return;
+	}
+	if (FT) {
+		FT(DP);
+		return;
+	}
+	// Adapter, Return keeps its capacity between calls (one per solving thread)
+	if (TFT) {
+		static thread_local vector<string> Return;
+		Return.clear();
+		TFT("FT", Return, DP);
+	}
+}
+
+void DependencyComponent::CallList(vector<string> &Return) const {
+	if (List) {
+		List(Return);
+		return;
+	}
+	// Adapter
+	if (TFT) {
+		vector<vector<DependencyPort> > DP;
+		TFT("List", Return, DP);
+		return;
+	}
+	Return.push_back(SmartDG_NOT_OK); // Function Not Found
+}
+
+void DependencyComponent::operator()(string Fun, vector<string> &Return,
+		vector<vector<DependencyPort> > &DP) {
+	if (TFT) {
+		TFT(Fun, Return, DP);
+		return;
+	}
+	if ((Fun == "TF") && TF) {
+		TF(DP);
+		Return.push_back(SmartDG_OK);
+		return;
+	}
+	if ((Fun == "FT") && FT) {
+		FT(DP);
+		Return.push_back(SmartDG_OK);
+		return;
+	}
+	if (Fun == "List") {
+		CallList(Return);
+		return;
+	}
+	Return.push_back(SmartDG_NOT_OK); // Function Not Found
+}
+
+DependencyComponent::~DependencyComponent() {
+}
+
+} /* namespace SmartDG */
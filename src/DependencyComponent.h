@@ -0,0 +1,133 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyComponent.h
+/// \brief	Header file for DependencyComponent class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DEPENDENCYCOMPONENT_H_
+#define DEPENDENCYCOMPONENT_H_
+
+#include "SmartDG.h"
+
+///> Smart Transfer/InverseTransfer Function Pointer Type (string dispatched)
+typedef void (*SFPT)(string, vector<string>&,
+		vector<vector<SmartDG::DependencyPort> >&);
+///> Smart Component Transfer (or InverseTransfer) Function Pointer Type (typed entry point)
+typedef void (*SCFPT)(vector<vector<SmartDG::DependencyPort> >&);
+///> Smart Component List Function Pointer Type (typed entry point)
+typedef void (*SLFPT)(vector<string>&);
+///> Smart Component Transfer (or InverseTransfer) Function Pointer Type (typed entry point with DependencyNode::Handles)
+typedef void (*SHFPT)(vector<vector<SmartDG::DependencyPort> >&,
+		const vector<SmartDG::URL>&);
+
+namespace SmartDG {
+////////////////////////////////////////////////////////////////////////////////
+///	\class DependencyComponent
+/// \brief DependencyComponent class holds the transfer functions of a Smart Component
+///
+/// A Smart Component is either typed, with separate transfer (TF), inverse transfer (FT)
+/// and List entry points that are called without building a command string or a result
+/// vector, or a string dispatched SFPT (adapter), so that SmartDG__map environments
+/// filled with SFPT function pointers keep working unchanged.
+///
+/// A typed Smart Component may declare the DependencyObjects it accesses in Bindings. These are
+/// resolved once per DependencyNode at graph build (DependencyNode::Bind()), and HTF/HFT are
+/// called with the resulting DependencyNode::Handles instead of searching DP by name.
+////////////////////////////////////////////////////////////////////////////////
+class DependencyComponent {
+public:
+	SFPT TFT; ///< String dispatched function (adapter), NULL for typed Smart Components
+	SCFPT TF; ///< Transfer function (typed entry point)
+	SCFPT FT; ///< Inverse transfer function (typed entry point)
+	SLFPT List; ///< List function (typed entry point)
+	SHFPT HTF; ///< Transfer function (typed entry point with DependencyNode::Handles)
+	SHFPT HFT; ///< Inverse transfer function (typed entry point with DependencyNode::Handles)
+	vector<string> Bindings; ///< "IO.Port.Obj" names of the DependencyObjects accessed by HTF and HFT
+	//////////////////////////////////////////////////
+	/// \fn DependencyComponent()
+	/// \brief Constructor, Sets all function pointers to NULL (calls do nothing)
+	//////////////////////////////////////////////////
+	DependencyComponent();
+	//////////////////////////////////////////////////
+	/// \fn DependencyComponent(SFPT tft)
+	/// \brief Constructor (adapter) for a string dispatched SFPT
+	/// \param [in] tft is DependencyComponent::TFT
+	///
+	/// - Implicit, so that SFPT function pointers can be placed in SmartDG__map
+	///
+	//////////////////////////////////////////////////
+	DependencyComponent(SFPT tft);
+	//////////////////////////////////////////////////
+	/// \fn DependencyComponent(SCFPT tf, SCFPT ft, SLFPT list)
+	/// \brief Constructor for a typed Smart Component
+	/// \param [in] tf is DependencyComponent::TF
+	/// \param [in] ft is DependencyComponent::FT
+	/// \param [in] list is DependencyComponent::List
+	//////////////////////////////////////////////////
+	DependencyComponent(SCFPT tf, SCFPT ft, SLFPT list);
+	//////////////////////////////////////////////////
+	/// \fn DependencyComponent(SHFPT htf, SHFPT hft, SLFPT list, const vector<string> &bindings)
+	/// \brief Constructor for a typed Smart Component that is called with DependencyNode::Handles
+	/// \param [in] htf is DependencyComponent::HTF
+	/// \param [in] hft is DependencyComponent::HFT
+	/// \param [in] list is DependencyComponent::List
+	/// \param [in] bindings is DependencyComponent::Bindings, e.g. "In.DGTestIn.alpha"
+	//////////////////////////////////////////////////
+	DependencyComponent(SHFPT htf, SHFPT hft, SLFPT list,
+			const vector<string> &bindings);
+	//////////////////////////////////////////////////
+	/// \fn void CallTF(vector<vector<DependencyPort> > &DP, const vector<URL> &Handles)
+	/// \brief Calls the transfer function
+	/// \param [in,out] DP is DependencyNode::DP of the DependencyNode
+	/// \param [in] Handles is DependencyNode::Handles of the DependencyNode (used by HTF)
+	//////////////////////////////////////////////////
+	void CallTF(vector<vector<DependencyPort> > &DP,
+			const vector<URL> &Handles);
+	//////////////////////////////////////////////////
+	/// \fn void CallFT(vector<vector<DependencyPort> > &DP, const vector<URL> &Handles)
+	/// \brief Calls the inverse transfer function
+	/// \param [in,out] DP is DependencyNode::DP of the DependencyNode
+	/// \param [in] Handles is DependencyNode::Handles of the DependencyNode (used by HFT)
+	//////////////////////////////////////////////////
+	void CallFT(vector<vector<DependencyPort> > &DP,
+			const vector<URL> &Handles);
+	//////////////////////////////////////////////////
+	/// \fn void CallList(vector<string> &Return) const
+	/// \brief Calls the List function
+	/// \param [out] Return is SmartDG_OK followed by the names of the functions, or SmartDG_NOT_OK
+	//////////////////////////////////////////////////
+	void CallList(vector<string> &Return) const;
+	//////////////////////////////////////////////////
+	/// \fn void operator()(string Fun, vector<string> &Return, vector<vector<DependencyPort> > &DP)
+	/// \brief String dispatched call, kept for callers of the SFPT interface
+	///
+	/// - HTF and HFT need DependencyNode::Handles and are only called by CallTF() and CallFT()
+	///
+	/// \param [in] Fun is "TF", "FT" or "List"
+	/// \param [out] Return is SmartDG_OK (followed by results) or SmartDG_NOT_OK
+	/// \param [in,out] DP is DependencyNode::DP of the DependencyNode
+	//////////////////////////////////////////////////
+	void operator()(string Fun, vector<string> &Return,
+			vector<vector<DependencyPort> > &DP);
+	//////////////////////////////////////////////////
+	/// \fn ~DependencyComponent()
+	/// \brief Default Destructor
+	//////////////////////////////////////////////////
+	virtual ~DependencyComponent();
+};
+
+} /* namespace SmartDG */
+
+///> A string map from DependencyNode::Name string to associated DependencyComponent (typed or SFPT)
+typedef std::unordered_map<std::string, SmartDG::DependencyComponent> SmartDG__map;
+
+#endif /* DEPENDENCYCOMPONENT_H_ */
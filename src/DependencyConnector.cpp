@@ -0,0 +1,42 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyConnector.cpp
+/// \brief	Source file for DependencyConnector class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+
+void DependencyConnector::Register(string type, CFPT tf, CFPT ft) {
+	functions[type] = make_pair(tf, ft);
+}
+
+void DependencyConnector::Register(const SmartDG__cmap &bindings) {
+	for (SmartDG__cmap::const_iterator it = bindings.begin();
+			it != bindings.end(); ++it)
+		Register(it->first, it->second.first, it->second.second);
+}
+
+void DependencyConnector::Assign(Dependency &d) {
+	SmartDG__cmap::const_iterator it = functions.find(
+			d.Name);
+	if (it == functions.end())
+		return;
+	d.TF = it->second.first;
+	d.FT = it->second.second;
+}
+
+// TF and FT for every registered Connector type
+SmartDG__cmap DependencyConnector::functions;
+
+} /* namespace SmartDG */
@@ -0,0 +1,88 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyConnector.h
+/// \brief	Header file for DependencyConnector class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DEPENDENCYCONNECTOR_H_
+#define DEPENDENCYCONNECTOR_H_
+
+#include "SmartDG.h"
+
+///> Connector Transfer/InverseTransfer Function Pointer Type
+typedef void (*CFPT)(vector<vector<SmartDG::DependencyPort> >&,
+		vector<vector<SmartDG::DependencyPort> >&, SmartDG::Dependency &);
+///> A map from Connector type to its transfer and inverse transfer functions
+typedef std::map<std::string, std::pair<CFPT, CFPT> > SmartDG__cmap;
+
+namespace SmartDG {
+////////////////////////////////////////////////////////////////////////////////
+///	\class DependencyConnector
+/// \brief DependencyConnector class binds Connector types (Environment::SmartConnectors) to
+/// transfer/inverse transfer functions
+///
+/// EnvironmentGenerator binds a policy to a Connector type in Environment::ConnectorFunctions, e.g.\n
+/// ConnectorFunctions["AF42"] = SmartDG::DependencyConnector::Bind<SmartDG::TransferFunctionsConnector::Inverting>();\n
+/// Environment::Environment() registers every binding and DependencyGraph::AddDependency() assigns
+/// Dependency::TF and Dependency::FT from it.
+/// Unregistered Connector types stay ideal connectors.\n
+/// All members are static, registration is expected before the DependencyGraph is built.
+////////////////////////////////////////////////////////////////////////////////
+class DependencyConnector {
+private:
+	static SmartDG__cmap functions; ///< TF and FT for every registered Connector type
+public:
+	//////////////////////////////////////////////////
+	/// \fn void Register(string type, CFPT tf, CFPT ft)
+	/// \brief Registers transfer/inverse transfer functions for a Connector type
+	/// \param [in] type is the Connector type (DependencyDescriptor::DependencyName)
+	/// \param [in] tf is the transfer function
+	/// \param [in] ft is the inverse transfer function
+	//////////////////////////////////////////////////
+	static void Register(string type, CFPT tf, CFPT ft);
+	//////////////////////////////////////////////////
+	/// \fn void Register(string type)
+	/// \brief Registers TransferFunctionsConnector::TF<Policy> and TransferFunctionsConnector::FT<Policy> for a Connector type
+	/// \param [in] type is the Connector type (DependencyDescriptor::DependencyName)
+	//////////////////////////////////////////////////
+	template<class Policy>
+	static void Register(string type) {
+		Register(type, &TransferFunctionsConnector::TF<Policy>,
+				&TransferFunctionsConnector::FT<Policy>);
+	}
+	//////////////////////////////////////////////////
+	/// \fn pair<CFPT, CFPT> Bind()
+	/// \brief Returns TransferFunctionsConnector::TF<Policy> and TransferFunctionsConnector::FT<Policy> as an Environment::ConnectorFunctions entry
+	//////////////////////////////////////////////////
+	template<class Policy>
+	static pair<CFPT, CFPT> Bind() {
+		return make_pair(&TransferFunctionsConnector::TF<Policy>,
+				&TransferFunctionsConnector::FT<Policy>);
+	}
+	//////////////////////////////////////////////////
+	/// \fn void Register(const SmartDG__cmap &bindings)
+	/// \brief Registers every Connector type of bindings (Environment::ConnectorFunctions)
+	//////////////////////////////////////////////////
+	static void Register(const SmartDG__cmap &bindings);
+	//////////////////////////////////////////////////
+	/// \fn void Assign(Dependency &d)
+	/// \brief Sets Dependency::TF and Dependency::FT of d from the functions registered for Dependency::Name
+	///
+	/// - Leaves d unchanged (ideal connector) if Dependency::Name is not registered
+	///
+	//////////////////////////////////////////////////
+	static void Assign(Dependency &d);
+};
+
+} /* namespace SmartDG */
+
+#endif /* DEPENDENCYCONNECTOR_H_ */
@@ -0,0 +1,166 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyContext.cpp
+/// \brief	Source file for DependencyContext class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+
+DependencyContext::DependencyContext() {
+	DOI = NULL;
+	// Calls DependencyContext::ResetContext() with all default values
+	ResetContext();
+}
+
+void DependencyContext::Attach(const DependencyObjectInstances &doi) {
+	DOI = &doi;
+	visible.assign(doi.I.size(), false);
+	editable.assign(doi.I.size(), false);
+}
+
+void DependencyContext::DisplayIf(unsigned int c) {
+	// Condition based Displays DependencyObjectInstance objects
+	// c is condition selector on visible and editable flags
+	for (unsigned int i = 0; i < visible.size(); i++) {
+		switch (c) {
+		// Display if both flags are true
+		case 0:
+			if (visible[i] && editable[i])
+				DOI->I[i].Display();
+			break;
+			// Display if visible is true
+		case 1:
+			if (visible[i])
+				DOI->I[i].Display();
+			break;
+			// Display if editable is true
+		case 2:
+			if (editable[i])
+				DOI->I[i].Display();
+			break;
+		}
+	}
+}
+
+void DependencyContext::SetContext(string v, string n, string i, string p,
+		string o) {
+	ResetContext(true);
+	ViewContext = v;
+	NodeContext = n;
+	IOContext = i;
+	PortContext = p;
+	ObjectContext = o;
+}
+
+void DependencyContext::SetContextHierarchy(string v, string n, string i,
+		string p, string o) {
+	if (v == "ALL") {
+		ResetContext(true);
+	} else {
+		ResetContext(true);
+		ViewContext = v;
+		if (n != "ALL")
+			NodeContext = n;
+		if (i != "ALL")
+			IOContext = i;
+		if (p != "ALL")
+			PortContext = p;
+		if (o != "ALL")
+			ObjectContext = o;
+	}
+}
+
+void DependencyContext::ResetContext(bool b) {
+	UseContext = b;
+	ViewContext = "ALL";
+	NodeContext = "ALL";
+	IOContext = "ALL";
+	PortContext = "ALL";
+	ObjectContext = "ALL";
+}
+
+void DependencyContext::DisplayContext() {
+	cout << ViewContext << "/" << NodeContext << "/" << IOContext << "/"
+			<< PortContext << "/" << ObjectContext << "  [" << UseContext << "]"
+			<< endl;
+}
+
+void DependencyContext::setf(unsigned int i, bool b, unsigned int c) {
+	// Base function called to set visible and editable flags of DOI->I[i]
+	switch (c) {
+	case 0:
+		visible[i] = b;
+		editable[i] = b;
+		break;
+	case 1:
+		visible[i] = b;
+		break;
+	case 2:
+		editable[i] = b;
+		break;
+	}
+}
+
+void DependencyContext::SetFlagContext(bool b, unsigned int c) {
+	// Set flag Value:b, Scope: Context, Condition: c
+	if (!UseContext)
+		return;
+	// Smallest index entry among the selectors that are not "ALL" (ObjectContext selects as ViewContext)
+	const vector<unsigned int> *candidates = NULL;
+	DependencyObjectInstances::Narrow(DOI->ByView, ViewContext, candidates);
+	DependencyObjectInstances::Narrow(DOI->ByNode, NodeContext, candidates);
+	DependencyObjectInstances::Narrow(DOI->ByIO, IOContext, candidates);
+	DependencyObjectInstances::Narrow(DOI->ByPort, PortContext, candidates);
+	DependencyObjectInstances::Narrow(DOI->ByView, ObjectContext, candidates);
+	if (candidates == NULL) {
+		for (unsigned int i = 0; i < visible.size(); i++)
+			setf(i, b, c);
+		return;
+	}
+	for (unsigned int k = 0; k < candidates->size(); k++)
+		if (InContext((*candidates)[k]))
+			setf((*candidates)[k], b, c);
+}
+
+void DependencyContext::SetFlagURL(string u, bool b, unsigned int c) {
+	// Set flag Value:b, Scope: DependencyObject associated with the given URL, Condition: c
+	unordered_map<string, vector<unsigned int>>::const_iterator it =
+			DOI->ByURL.find(u);
+	if (it != DOI->ByURL.end())
+		for (unsigned int k = 0; k < it->second.size(); k++)
+			setf(it->second[k], b, c);
+}
+
+void DependencyContext::SetFlagMenuIDString(string m, bool b, unsigned int c) {
+	// Set flag Value:b, Scope: DependencyObject associated with the given Menu selection string, Condition: c
+	unordered_map<string, vector<unsigned int>>::const_iterator it =
+			DOI->ByMenu.find(m);
+	if (it != DOI->ByMenu.end())
+		for (unsigned int k = 0; k < it->second.size(); k++)
+			setf(it->second[k], b, c);
+}
+
+bool DependencyContext::InContext(unsigned int i) {
+	const URL &u = DOI->I[i].pou;
+	return ((ViewContext == "ALL") || (ViewContext == u.stro()))
+			&& ((NodeContext == "ALL") || (NodeContext == u.strn()))
+			&& ((IOContext == "ALL") || (IOContext == u.strio()))
+			&& ((PortContext == "ALL") || (PortContext == u.strp()))
+			&& ((ObjectContext == "ALL") || (ObjectContext == u.stro()));
+}
+
+DependencyContext::~DependencyContext() {
+}
+
+} /* namespace SmartDG */
@@ -0,0 +1,171 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyContext.h
+/// \brief	Header file for DependencyContext class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DEPENDENCYCONTEXT_H_
+#define DEPENDENCYCONTEXT_H_
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+////////////////////////////////////////////////////////////////////////////////
+///	\class DependencyContext
+/// \brief DependencyContext class models the menu context of a DependencyMonitor
+///
+/// This class encapsulates the context selector strings and the menu visibility and editability
+/// flags of every DependencyObjectInstance object in DependencyObjectInstances::I.\n
+/// The DependencyObjectInstances object is part of the DependencyGraph shared by all DependencyMonitor
+/// objects of a system, while each DependencyMonitor object keeps a DependencyContext object of its own.
+////////////////////////////////////////////////////////////////////////////////
+class DependencyContext {
+public:
+	const DependencyObjectInstances *DOI; ///< Points to the DependencyObjectInstances object the flags refer to
+	vector<bool> visible; ///< Menu display enabling flag for every DependencyObjectInstances::I entry
+	vector<bool> editable; ///< Menu edit enabling flag for every DependencyObjectInstances::I entry
+	bool UseContext; ///< Boolean flag to enable/disable the use of Context based setting of visibility and editability for DependencyObjectInstance objects.
+	string ViewContext; ///< Context string for DependencyView selection
+	string NodeContext; ///< Context string for DependencyNode selection
+	string IOContext; ///< Context string for I/O DependencyPort group selection
+	string PortContext; ///< Context string for DependencyPort selection
+	string ObjectContext; ///< Context string for DependencyObject selection
+	//////////////////////////////////////////////////
+	/// \fn DependencyContext()
+	/// \brief Constructor
+	///
+	/// - Sets DependencyContext::DOI : NULL\n
+	/// - Calls DependencyContext::ResetContext() with all default values
+	///
+	//////////////////////////////////////////////////
+	DependencyContext();
+	//////////////////////////////////////////////////
+	/// \fn Attach(const DependencyObjectInstances &doi)
+	/// \brief Attaches the DependencyContext object to a DependencyObjectInstances object
+	/// \param [in] doi is the DependencyObjectInstances object
+	///
+	/// - Sets DependencyContext::DOI : &doi\n
+	/// - Sizes DependencyContext::visible and DependencyContext::editable to doi.I (false)
+	///
+	//////////////////////////////////////////////////
+	void Attach(const DependencyObjectInstances &doi);
+	//////////////////////////////////////////////////
+	/// \fn DisplayIf(unsigned int c=0)
+	/// \brief Calls DependencyObjectInstance::Display() for each DependencyObjectInstance object whose flags meet condition c
+	///
+	/// \param [in] c is condition selector on DependencyContext::visible and
+	/// DependencyContext::editable flags
+	///
+	/// - c : 0 : Display if both flags are true\n
+	/// - c : 1 : Display if DependencyContext::visible is true\n
+	/// - c : 2 : Display if DependencyContext::editable is true
+	///
+	//////////////////////////////////////////////////
+	void DisplayIf(unsigned int c = 0);
+	//////////////////////////////////////////////////
+	/// \fn SetContext(string v="ALL",string n="ALL",string i="ALL",string p="ALL",string o="ALL")
+	/// \brief Sets context selector strings from given arguments
+	/// \param [in] v is context selector string for DependencyContext::ViewContext (Default : "ALL")
+	/// \param [in] n is context selector string for DependencyContext::NodeContext (Default : "ALL")
+	/// \param [in] i is context selector string for DependencyContext::IOContext (Default : "ALL")
+	/// \param [in] p is context selector string for DependencyContext::PortContext (Default : "ALL")
+	/// \param [in] o is context selector string for DependencyContext::ObjectContext (Default : "ALL")
+	///
+	/// \see SetContextHierarchy(string v="ALL",string n="ALL",string i="ALL",string p="ALL",string o="ALL")
+	//////////////////////////////////////////////////
+	void SetContext(string v = "ALL", string n = "ALL", string i = "ALL",
+			string p = "ALL", string o = "ALL");
+	//////////////////////////////////////////////////
+	/// \fn SetContextHierarchy(string v="ALL",string n="ALL",string i="ALL",string p="ALL",string o="ALL")
+	/// \brief Hierarchically sets context selector strings from given arguments
+	/// \param [in] v is context selector string for DependencyContext::ViewContext (Default : "ALL")
+	/// \param [in] n is context selector string for DependencyContext::NodeContext (Default : "ALL")
+	/// \param [in] i is context selector string for DependencyContext::IOContext (Default : "ALL")
+	/// \param [in] p is context selector string for DependencyContext::PortContext (Default : "ALL")
+	/// \param [in] o is context selector string for DependencyContext::ObjectContext (Default : "ALL")
+	///
+	/// - Selectors below v are only used if v is not "ALL"
+	///
+	/// \see SetContext(string v="ALL",string n="ALL",string i="ALL",string p="ALL",string o="ALL")
+	//////////////////////////////////////////////////
+	void SetContextHierarchy(string v = "ALL", string n = "ALL", string i =
+			"ALL", string p = "ALL", string o = "ALL");
+	//////////////////////////////////////////////////
+	/// \fn ResetContext(bool b=false)
+	/// \brief Resets selector strings and DependencyContext::UseContext flag
+	/// \param [in] b is value to be set for DependencyContext::UseContext
+	///
+	/// - Default value for b is false
+	/// - Sets DependencyContext::UseContext : b\n
+	/// - Sets all context selector strings : "ALL"
+	///
+	//////////////////////////////////////////////////
+	void ResetContext(bool b = false);
+	//////////////////////////////////////////////////
+	/// \fn DisplayContext()
+	/// \brief Display current context selector strings
+	//////////////////////////////////////////////////
+	void DisplayContext();
+	//////////////////////////////////////////////////
+	/// \fn setf(unsigned int i, bool b, unsigned int c=0)
+	/// \brief Base function called to set DependencyContext::visible and DependencyContext::editable flags of DependencyObjectInstances::I [i]
+	/// \param [in] i is index of DependencyObjectInstance object in DependencyObjectInstances::I
+	/// \param [in] b is Boolean value to be set
+	/// \param [in] c is condition selector on DependencyContext::visible and DependencyContext::editable flags
+	///
+	/// - c : 0 : Sets both flags\n
+	/// - c : 1 : Sets DependencyContext::visible\n
+	/// - c : 2 : Sets DependencyContext::editable
+	///
+	//////////////////////////////////////////////////
+	void setf(unsigned int i, bool b, unsigned int c = 0);
+	//////////////////////////////////////////////////
+	/// \fn SetFlagContext(bool b, unsigned int c=0)
+	/// \brief Set flag Value:b, Scope: Context, Condition: c
+	/// \param [in] b is Boolean value to be set
+	/// \param [in] c is condition selector (see setf())
+	///
+	/// - Visits only the instances of the most selective context selector that is not "ALL"
+	///
+	//////////////////////////////////////////////////
+	void SetFlagContext(bool b, unsigned int c = 0);
+	//////////////////////////////////////////////////
+	/// \fn SetFlagURL(string u, bool b, unsigned int c=0)
+	/// \brief Set flag Value:b, Scope: DependencyObject associated with the given URL, Condition: c
+	/// \param [in] u is URL string of DependencyObject which is to be set
+	/// \param [in] b is Boolean value to be set
+	/// \param [in] c is condition selector (see setf())
+	//////////////////////////////////////////////////
+	void SetFlagURL(string u, bool b, unsigned int c = 0);
+	//////////////////////////////////////////////////
+	/// \fn SetFlagMenuIDString(string m, bool b, unsigned int c=0)
+	/// \brief Set flag Value:b, Scope: DependencyObject associated with the given Menu selection string, Condition: c
+	/// \param [in] m is Menu selection string of DependencyObject which is to be set
+	/// \param [in] b is Boolean value to be set
+	/// \param [in] c is condition selector (see setf())
+	//////////////////////////////////////////////////
+	void SetFlagMenuIDString(string m, bool b, unsigned int c = 0);
+	//////////////////////////////////////////////////
+	/// \fn bool InContext(unsigned int i)
+	/// \brief Returns true if DependencyObjectInstances::I [i] matches all context selector strings
+	//////////////////////////////////////////////////
+	bool InContext(unsigned int i);
+	//////////////////////////////////////////////////
+	/// \fn ~DependencyContext()
+	/// \brief Default Destructor
+	//////////////////////////////////////////////////
+	virtual ~DependencyContext();
+};
+
+} /* namespace SmartDG */
+
+#endif /* DEPENDENCYCONTEXT_H_ */
@@ -0,0 +1,252 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyDataBuffer.cpp
+/// \brief	Source file for DependencyDataBuffer class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+
+// Number of set bits in a word
+static inline unsigned int popcount(uint64_t w) {
+	return bitset<64>(w).count();
+}
+
+// Mask of the valid bits in the last word of a bitset holding n values
+static inline uint64_t tailmask(unsigned int n) {
+	return (n % 64) ? ((uint64_t(1) << (n % 64)) - 1) : ~uint64_t(0);
+}
+
+DependencyDataBuffer::DependencyDataBuffer() {
+	n = 0;
+	version = 0;
+	changes = NULL;
+}
+
+DependencyDataBuffer::DependencyDataBuffer(const DependencyDataBuffer &from) {
+	changes = NULL;
+	*this = from;
+}
+
+DependencyDataBuffer& DependencyDataBuffer::operator=(
+		const DependencyDataBuffer &from) {
+	// Copies all values
+	b = from.b;
+	t = from.t;
+	v = from.v;
+	changed = from.changed;
+	n = from.n;
+	version = from.version;
+	return *this;
+}
+
+unsigned int DependencyDataBuffer::Add(DependencyDataPackage d) {
+	if (n % 64 == 0)
+		changed.push_back(0);
+#if SmartDG_PACKED_VALUES
+	if (n % 64 == 0)
+		b.push_back(0);
+	if (d.b)
+		b[n / 64] |= uint64_t(1) << (n % 64);
+#else
+	b.push_back(d.b);
+#endif
+	if ((d.type != SmartDG_DATATYPE_BOOL) || !t.empty()) {
+		Typed();
+		t.push_back(d.type);
+		v.push_back(d.v);
+	}
+	return n++;
+}
+
+DependencyDataPackage DependencyDataBuffer::Get(unsigned int id) {
+	// Packs data items of the value as DependencyDataPackage
+	DependencyDataPackage d;
+#if SmartDG_PACKED_VALUES
+	d.b = (b[id / 64] >> (id % 64)) & 1;
+#else
+	d.b = b[id];
+#endif
+	if (!t.empty()) {
+		d.type = t[id];
+		d.v = v[id];
+	}
+	return d;
+}
+
+void DependencyDataBuffer::Set(unsigned int id, DependencyDataPackage d) {
+	// Boolean values of an all boolean buffer
+	if (t.empty() && (d.type == SmartDG_DATATYPE_BOOL)) {
+		Set(id, d.b);
+		return;
+	}
+	Typed();
+	if (Get(id) == d)
+		return;
+	// Sets argument type and value to data items
+#if SmartDG_PACKED_VALUES
+	if (((b[id / 64] >> (id % 64)) & 1) != d.b)
+		b[id / 64] ^= uint64_t(1) << (id % 64);
+#else
+	b[id] = d.b;
+#endif
+	t[id] = d.type;
+	v[id] = d.v;
+	// In case there is a change in type or value, marks the value
+	Mark(id);
+}
+
+void DependencyDataBuffer::Set(unsigned int id, bool in) {
+	// Non boolean values may change type
+	if (!t.empty()) {
+		DependencyDataPackage d;
+		d.b = in;
+		Set(id, d);
+		return;
+	}
+	if (Get(id).b == in)
+		return;
+	// Sets argument value to data item
+#if SmartDG_PACKED_VALUES
+	b[id / 64] ^= uint64_t(1) << (id % 64);
+#else
+	b[id] = in;
+#endif
+	// In case there is a change in value, marks the value
+	Mark(id);
+}
+
+void DependencyDataBuffer::Fill(bool in) {
+#if SmartDG_PACKED_VALUES
+	if (t.empty()) {
+		for (unsigned int w = 0; w < b.size(); w++) {
+			uint64_t to = in ? ~uint64_t(0) : 0;
+			if (w == b.size() - 1)
+				to &= tailmask(n);
+			// Changes are found word-wide
+			uint64_t diff = b[w] ^ to;
+			b[w] = to;
+			changed[w] |= diff;
+			if (diff != 0)
+				version++;
+			if ((changes == NULL) || (diff == 0))
+				continue;
+			if (!changes->record)
+				changes->count += popcount(diff);
+			else
+				for (unsigned int k = 0; k < 64; k++)
+					if ((diff >> k) & 1)
+						changes->Add(w * 64 + k);
+		}
+		return;
+	}
+#endif
+	for (unsigned int id = 0; id < n; id++)
+		Set(id, in);
+}
+
+void DependencyDataBuffer::Mark(unsigned int id) {
+	changed[id / 64] |= uint64_t(1) << (id % 64);
+	version++;
+	if (changes != NULL)
+		changes->Add(id);
+}
+
+void DependencyDataBuffer::Track(DependencyDataChanges *c) {
+	changes = c;
+}
+
+unsigned int DependencyDataBuffer::Count() {
+	unsigned int tot = 0;
+#if SmartDG_PACKED_VALUES
+	for (unsigned int w = 0; w < b.size(); w++)
+		tot += popcount(b[w]);
+#else
+	for (unsigned int id = 0; id < n; id++)
+		tot += b[id];
+#endif
+	return tot;
+}
+
+unsigned int DependencyDataBuffer::Count(const vector<unsigned int> &ids) {
+	unsigned int tot = 0;
+	for (unsigned int i = 0; i < ids.size(); i++)
+		if (Get(ids[i]).b)
+			tot++;
+	return tot;
+}
+
+unsigned int DependencyDataBuffer::Diff(DependencyDataBuffer &other) {
+	unsigned int m = min(n, other.n);
+	// Values present in only one of the two buffers count as different
+	unsigned int tot = max(n, other.n) - m;
+	// Compares value by value when either buffer holds non boolean values
+	if (!t.empty() || !other.t.empty()) {
+		for (unsigned int id = 0; id < m; id++)
+			if (Get(id) != other.Get(id))
+				tot++;
+		return tot;
+	}
+#if SmartDG_PACKED_VALUES
+	for (unsigned int w = 0; w < (m + 63) / 64; w++) {
+		uint64_t diff = b[w] ^ other.b[w];
+		if (w == (m + 63) / 64 - 1)
+			diff &= tailmask(m);
+		tot += popcount(diff);
+	}
+#else
+	for (unsigned int id = 0; id < m; id++)
+		if (b[id] != other.b[id])
+			tot++;
+#endif
+	return tot;
+}
+
+bool DependencyDataBuffer::Changed(unsigned int id) {
+	return (changed[id / 64] >> (id % 64)) & 1;
+}
+
+unsigned int DependencyDataBuffer::Changed() {
+	unsigned int tot = 0;
+	for (unsigned int w = 0; w < changed.size(); w++)
+		tot += popcount(changed[w]);
+	return tot;
+}
+
+void DependencyDataBuffer::ClearChanged() {
+	fill(changed.begin(), changed.end(), 0);
+}
+
+unsigned int DependencyDataBuffer::size() {
+	return n;
+}
+
+void DependencyDataBuffer::clear() {
+	b.clear();
+	t.clear();
+	v.clear();
+	changed.clear();
+	n = 0;
+}
+
+void DependencyDataBuffer::Typed() {
+	if (t.empty()) {
+		t.assign(n, SmartDG_DATATYPE_BOOL);
+		v.assign(n, 0);
+	}
+}
+
+DependencyDataBuffer::~DependencyDataBuffer() {
+}
+
+} /* namespace SmartDG */
@@ -0,0 +1,208 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyDataBuffer.h
+/// \brief	Header file for DependencyDataBuffer class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DEPENDENCYDATABUFFER_H_
+#define DEPENDENCYDATABUFFER_H_
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+////////////////////////////////////////////////////////////////////////////////
+///	\class DependencyDataBuffer
+/// \brief DependencyDataBuffer class stores the values of all Unique Dependency Instances of a DependencyGraph
+///
+/// This class encapsulates one contiguous array per data item of DependencyDataPackage
+/// (structure of arrays) indexed by a dense value id. DependencyGraph::AddDependency assigns
+/// value id 2 * Dependency::id to the Source end and 2 * Dependency::id + 1 to the Target end
+/// of every Dependency.\n
+/// With SmartDG_PACKED_VALUES the boolean data item is bit-packed 64 values per word, so that
+/// bulk operations (Fill, Count, Diff) run word-wide. A parallel bitset records which values
+/// changed since the last call to ClearChanged().\n
+/// Data type and payload bits of non boolean values (see DependencyDataPackage) are kept in two
+/// more arrays, which stay empty (no memory and no extra work) as long as all values are boolean.
+/// \see Dependency::FromValue() \see Dependency::ToValue()
+////////////////////////////////////////////////////////////////////////////////
+class DependencyDataBuffer {
+public:
+#if SmartDG_PACKED_VALUES
+	vector<uint64_t> b; ///< Boolean data item of every value (bit id % 64 of word id / 64)
+#else
+	vector<unsigned char> b; ///< Boolean data item of every value (indexed by value id)
+#endif
+	vector<unsigned char> t; ///< Data type of every value (empty while all values are SmartDG_DATATYPE_BOOL)
+	vector<uint64_t> v; ///< Payload bits of every value (empty while all values are SmartDG_DATATYPE_BOOL)
+	vector<uint64_t> changed; ///< Bit per value, set when the value changes (bit id % 64 of word id / 64)
+	DependencyDataChanges *changes; ///< Points to DependencyDataChanges object recording changes of the current solve (NULL if none)
+	unsigned int n; ///< Number of values
+	unsigned long version; ///< Incremented by every change of a value (tells DependencyGraph objects sharing the buffer that data moved)
+	//////////////////////////////////////////////////
+	/// \fn DependencyDataBuffer()
+	/// \brief Constructor
+	//////////////////////////////////////////////////
+	DependencyDataBuffer();
+	//////////////////////////////////////////////////
+	/// \fn DependencyDataBuffer(const DependencyDataBuffer &from)
+	/// \brief Copy Constructor
+	///
+	/// - Copies all values\n
+	/// - Sets DependencyDataBuffer::changes : NULL (a copy does not record into the solve of the original)
+	///
+	//////////////////////////////////////////////////
+	DependencyDataBuffer(const DependencyDataBuffer &from);
+	//////////////////////////////////////////////////
+	/// \fn operator=(const DependencyDataBuffer &from)
+	/// \brief Assignment operator
+	///
+	/// - Copies all values\n
+	/// - Keeps DependencyDataBuffer::changes
+	///
+	//////////////////////////////////////////////////
+	DependencyDataBuffer& operator=(const DependencyDataBuffer &from);
+	//////////////////////////////////////////////////
+	/// \fn unsigned int Add(DependencyDataPackage d)
+	/// \brief Appends a value
+	/// \param [in] d is the initial value
+	/// \return [unsigned int] value id of the new value
+	//////////////////////////////////////////////////
+	unsigned int Add(DependencyDataPackage d);
+	//////////////////////////////////////////////////
+	/// \fn DependencyDataPackage Get(unsigned int id)
+	/// \brief Gets a value
+	/// \param [in] id is the value id
+	/// \return [DependencyDataPackage] the value packed as DependencyDataPackage
+	//////////////////////////////////////////////////
+	DependencyDataPackage Get(unsigned int id);
+	//////////////////////////////////////////////////
+	/// \fn void Set(unsigned int id, DependencyDataPackage d)
+	/// \brief Sets a value
+	/// \param [in] id is the value id
+	/// \param [in] d is the value to be set
+	///
+	/// - Sets argument type and value to data items (allocates DependencyDataBuffer::t and
+	/// DependencyDataBuffer::v on the first non boolean value)\n
+	/// - In case there is a change in type or value, calls Mark(unsigned int id)
+	///
+	/// \see Set(unsigned int id, bool in)
+	//////////////////////////////////////////////////
+	void Set(unsigned int id, DependencyDataPackage d);
+	//////////////////////////////////////////////////
+	/// \fn void Set(unsigned int id, bool in)
+	/// \brief Sets the boolean data item of a value
+	/// \param [in] id is the value id
+	/// \param [in] in is the value to be set
+	///
+	/// - Sets argument value to data item (type becomes SmartDG_DATATYPE_BOOL)\n
+	/// - In case there is a change in value, calls Mark(unsigned int id)
+	///
+	/// \see Set(unsigned int id, DependencyDataPackage d)
+	//////////////////////////////////////////////////
+	void Set(unsigned int id, bool in);
+	//////////////////////////////////////////////////
+	/// \fn void Fill(bool in)
+	/// \brief Sets the boolean data item of all values
+	/// \param [in] in is the value to be set
+	///
+	/// - Changes are found word-wide (XOR with the new value), marked in changed and
+	/// recorded in DependencyDataBuffer::changes
+	///
+	//////////////////////////////////////////////////
+	void Fill(bool in);
+	//////////////////////////////////////////////////
+	/// \fn void Mark(unsigned int id)
+	/// \brief Marks a changed value
+	/// \param [in] id is the value id
+	///
+	/// - Sets the bit of the value in DependencyDataBuffer::changed\n
+	/// - Increments DependencyDataBuffer::version\n
+	/// - Records the change in DependencyDataBuffer::changes (if any)
+	///
+	//////////////////////////////////////////////////
+	void Mark(unsigned int id);
+	//////////////////////////////////////////////////
+	/// \fn void Track(DependencyDataChanges *c)
+	/// \brief Sets DependencyDataBuffer::changes
+	/// \param [in] c points to the DependencyDataChanges object to record changes in (NULL to stop recording)
+	//////////////////////////////////////////////////
+	void Track(DependencyDataChanges *c);
+	//////////////////////////////////////////////////
+	/// \fn unsigned int Count()
+	/// \brief Returns number of values whose boolean data item is true (word-wide popcount)
+	///
+	/// - Non boolean values count by their boolean view (DependencyDataPackage::b)
+	///
+	/// \see Count(const vector<unsigned int> &ids)
+	//////////////////////////////////////////////////
+	unsigned int Count();
+	//////////////////////////////////////////////////
+	/// \fn unsigned int Count(const vector<unsigned int> &ids)
+	/// \brief Returns number of values in ids whose boolean data item is true
+	/// \param [in] ids are the value ids
+	/// \see Count()
+	//////////////////////////////////////////////////
+	unsigned int Count(const vector<unsigned int> &ids);
+	//////////////////////////////////////////////////
+	/// \fn unsigned int Diff(DependencyDataBuffer &other)
+	/// \brief Returns number of values that differ from other (word-wide XOR and popcount)
+	/// \param [in] other is the DependencyDataBuffer to compare with
+	///
+	/// - Values present in only one of the two buffers count as different\n
+	/// - Compares value by value when either buffer holds non boolean values
+	///
+	//////////////////////////////////////////////////
+	unsigned int Diff(DependencyDataBuffer &other);
+	//////////////////////////////////////////////////
+	/// \fn bool Changed(unsigned int id)
+	/// \brief Returns true if the value changed since the last call to ClearChanged()
+	/// \param [in] id is the value id
+	/// \see Changed() \see ClearChanged()
+	//////////////////////////////////////////////////
+	bool Changed(unsigned int id);
+	//////////////////////////////////////////////////
+	/// \fn unsigned int Changed()
+	/// \brief Returns number of values changed since the last call to ClearChanged() (word-wide popcount)
+	/// \see Changed(unsigned int id) \see ClearChanged()
+	//////////////////////////////////////////////////
+	unsigned int Changed();
+	//////////////////////////////////////////////////
+	/// \fn void ClearChanged()
+	/// \brief Clears changed marks of all values
+	/// \see Changed(unsigned int id) \see Changed()
+	//////////////////////////////////////////////////
+	void ClearChanged();
+	//////////////////////////////////////////////////
+	/// \fn unsigned int size()
+	/// \brief Returns number of values
+	//////////////////////////////////////////////////
+	unsigned int size();
+	//////////////////////////////////////////////////
+	/// \fn void clear()
+	/// \brief Removes all values
+	//////////////////////////////////////////////////
+	void clear();
+	//////////////////////////////////////////////////
+	/// \fn void Typed()
+	/// \brief Allocates DependencyDataBuffer::t and DependencyDataBuffer::v (all values SmartDG_DATATYPE_BOOL) if empty
+	//////////////////////////////////////////////////
+	void Typed();
+	//////////////////////////////////////////////////
+	/// \fn ~DependencyDataBuffer()
+	/// \brief Default Destructor
+	//////////////////////////////////////////////////
+	virtual ~DependencyDataBuffer();
+};
+
+} /* namespace SmartDG */
+
+#endif /* DEPENDENCYDATABUFFER_H_ */
@@ -0,0 +1,39 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyDataChanges.cpp
+/// \brief	Source file for DependencyDataChanges class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+
+DependencyDataChanges::DependencyDataChanges(bool rec) {
+	record = rec;
+	count = 0;
+}
+
+void DependencyDataChanges::Add(unsigned int id) {
+	count++;
+	if (record)
+		ids.push_back(id);
+}
+
+void DependencyDataChanges::Reset() {
+	count = 0;
+	ids.clear();
+}
+
+DependencyDataChanges::~DependencyDataChanges() {
+}
+
+} /* namespace SmartDG */
@@ -0,0 +1,63 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyDataChanges.h
+/// \brief	Header file for DependencyDataChanges class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DEPENDENCYDATACHANGES_H_
+#define DEPENDENCYDATACHANGES_H_
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+////////////////////////////////////////////////////////////////////////////////
+///	\class DependencyDataChanges
+/// \brief DependencyDataChanges class records the changes made to a DependencyDataBuffer during one solve
+///
+/// A DependencyDataChanges object is attached to a DependencyDataBuffer (DependencyDataBuffer::changes)
+/// for the duration of one DependencyGraph::Solve() invocation. Every change of a value through the
+/// buffer, including the ones made by Connector TF/FT and Component TFT, is counted and (optionally)
+/// listed, so that convergence checks do not depend on any process-wide state.
+/// \see DependencyDataBuffer::Track(DependencyDataChanges *c)
+////////////////////////////////////////////////////////////////////////////////
+class DependencyDataChanges {
+public:
+	unsigned long count; ///< Number of changes recorded since Reset()
+	bool record; ///< When true, value ids of changes are listed in DependencyDataChanges::ids
+	vector<unsigned int> ids; ///< Value ids changed since Reset() (Dependency::id is value id / 2), filled only if DependencyDataChanges::record is true
+	//////////////////////////////////////////////////
+	/// \fn DependencyDataChanges(bool rec = false)
+	/// \brief Constructor
+	/// \param [in] rec sets DependencyDataChanges::record
+	//////////////////////////////////////////////////
+	DependencyDataChanges(bool rec = false);
+	//////////////////////////////////////////////////
+	/// \fn void Add(unsigned int id)
+	/// \brief Records a change of value id
+	/// \param [in] id is the value id
+	//////////////////////////////////////////////////
+	void Add(unsigned int id);
+	//////////////////////////////////////////////////
+	/// \fn void Reset()
+	/// \brief Clears count and ids
+	//////////////////////////////////////////////////
+	void Reset();
+	//////////////////////////////////////////////////
+	/// \fn ~DependencyDataChanges()
+	/// \brief Default Destructor
+	//////////////////////////////////////////////////
+	virtual ~DependencyDataChanges();
+};
+
+} /* namespace SmartDG */
+
+#endif /* DEPENDENCYDATACHANGES_H_ */
@@ -19,15 +19,57 @@ namespace SmartDG {
 
 DependencyDataPackage::DependencyDataPackage() {
 	// Sets Default value for data items
+	type = SmartDG_DATATYPE_BOOL;
 	b = false;
+	v = 0;
 }
 
 void DependencyDataPackage::Set(bool in) {
-	if (b != in) {
+	if ((b != in) || (type != SmartDG_DATATYPE_BOOL)) {
 		// Sets argument value to data items
+		type = SmartDG_DATATYPE_BOOL;
 		b = in;
+		v = 0;
 		// In case there is a change in value, static variable delta is incremented
-		DependencyDataPackage::delta++;
+		DependencyDataPackage::delta.fetch_add(1, memory_order_relaxed);
+	}
+}
+
+void DependencyDataPackage::Set(DependencyDataPackage in) {
+	if (*this != in) {
+		type = in.type;
+		b = in.b;
+		v = in.v;
+		// In case there is a change in type or value, static variable delta is incremented
+		DependencyDataPackage::delta.fetch_add(1, memory_order_relaxed);
+	}
+}
+
+void DependencyDataPackage::SetInt(int64_t in) {
+	SetBits(SmartDG_DATATYPE_INT, uint64_t(in));
+}
+
+void DependencyDataPackage::SetReal(double in) {
+	uint64_t bits;
+	memcpy(&bits, &in, sizeof(bits));
+	// -0.0 is stored as 0.0 so that equal values have equal bits
+	if (in == 0)
+		bits = 0;
+	SetBits(SmartDG_DATATYPE_REAL, bits);
+}
+
+void DependencyDataPackage::SetEnum(unsigned int in) {
+	SetBits(SmartDG_DATATYPE_ENUM, in);
+}
+
+void DependencyDataPackage::SetBits(unsigned char t, uint64_t bits) {
+	if ((type != t) || (v != bits)) {
+		type = t;
+		v = bits;
+		// Boolean view of the value
+		b = (bits != 0);
+		// In case there is a change in type or value, static variable delta is incremented
+		DependencyDataPackage::delta.fetch_add(1, memory_order_relaxed);
 	}
 }
 
@@ -36,12 +78,58 @@ bool DependencyDataPackage::Get() {
 	return b;
 }
 
-string DependencyDataPackage::toStr() {
+int64_t DependencyDataPackage::GetInt() {
+	if (type == SmartDG_DATATYPE_BOOL)
+		return b;
+	if (type == SmartDG_DATATYPE_REAL)
+		return GetReal();
+	return int64_t(v);
+}
+
+double DependencyDataPackage::GetReal() {
+	if (type != SmartDG_DATATYPE_REAL)
+		return GetInt();
+	double out;
+	memcpy(&out, &v, sizeof(out));
+	return out;
+}
+
+unsigned int DependencyDataPackage::GetEnum() {
+	return GetInt();
+}
+
+string DependencyDataPackage::toStr() const {
 	// Returns value of data items converted to string
-	if (b)
-		return string("T");
+	if (type == SmartDG_DATATYPE_BOOL) {
+		if (b)
+			return string("T");
+		else
+			return string("F");
+	}
+	// Boolean view, ':', type letter and value for other types
+	ostringstream os;
+	os << (b ? "T:" : "F:");
+	if (type == SmartDG_DATATYPE_INT)
+		os << "i" << int64_t(v);
+	else if (type == SmartDG_DATATYPE_REAL) {
+		double r;
+		memcpy(&r, &v, sizeof(r));
+		os << "d" << r;
+	} else if (type == SmartDG_DATATYPE_ENUM)
+		os << "e" << v;
 	else
-		return string("F");
+		os << "x" << hex << setw(16) << setfill('0') << v;
+	return os.str();
+}
+
+bool DependencyDataPackage::operator==(
+		const DependencyDataPackage &other) const {
+	return (type == other.type) && (b == other.b) && (v == other.v);
+}
+
+bool DependencyDataPackage::operator!=(
+		const DependencyDataPackage &other) const {
+	return !(*this == other);
 }
 
 DependencyDataPackage::~DependencyDataPackage() {
@@ -49,6 +137,6 @@ DependencyDataPackage::~DependencyDataPackage() {
 
 // This static variable is part of a mechanism to detect any change across all objects of DependencyDataPackage class
 // Here it is assigned to its default value
-unsigned long DependencyDataPackage::delta = 0;
+atomic<unsigned long> DependencyDataPackage::delta(0);
 
 } /* namespace SmartDG */
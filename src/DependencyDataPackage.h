@@ -24,15 +24,20 @@ namespace SmartDG {
 /// \brief DependencyDataPackage class models dependency object data package sent over a connection
 ///
 /// This class encapsulates data items in a dependency object instance
-/// that may be sent over a named connection.
-/// \todo At present we only support a single boolean data item, this will be expanded later
+/// that may be sent over a named connection.\n
+/// A data package holds a single typed value (SmartDG_DATATYPE_BOOL, SmartDG_DATATYPE_INT,
+/// SmartDG_DATATYPE_REAL, SmartDG_DATATYPE_ENUM or a trivially copyable SmartDG_DATATYPE_STRUCT
+/// of at most 8 bytes). Non boolean values are stored in place as 64 payload bits (no heap
+/// allocation), and DependencyDataPackage::b always holds the boolean view of the value
+/// (true when the value is non zero) so that boolean transfer functions and the GUI keep working.
 /// \see inline std::ostream& operator << (std::ostream& os, const DependencyDataPackage& var)
 ////////////////////////////////////////////////////////////////////////////////
 class DependencyDataPackage {
 public:
-	static unsigned long delta; ///< Part of a mechanism to detect any change across all objects of DependencyDataPackage class
-	//#TODO  At present we only support a single boolean data item, this will be expanded later
-	bool b; ///< Single boolean data item \todo At present we only support a single boolean data item, this will be expanded later
+	static atomic<unsigned long> delta; ///< Part of a mechanism to detect any change across all objects of DependencyDataPackage class (values held in a DependencyDataBuffer record their changes in DependencyDataBuffer::changes instead); atomic, as transfer functions may run concurrently (SmartDGGenerator::SolveAll)
+	unsigned char type; ///< Data type of the value (SmartDG_DATATYPE_BOOL, ...)
+	bool b; ///< Boolean data item (boolean view of non boolean values: true when non zero)
+	uint64_t v; ///< Payload bits of non boolean values (0 for SmartDG_DATATYPE_BOOL)
 	//////////////////////////////////////////////////
 	/// \fn DependencyDataPackage()
 	/// \brief Constructor
@@ -45,26 +50,119 @@ public:
 	/// \brief Sets value to data items
 	/// \param [in] in is the value to be set
 	///
-	/// - Sets argument value to data items
+	/// - Sets argument value to data items (type becomes SmartDG_DATATYPE_BOOL)
 	/// - In case there is a change in value, static variable delta is incremented
 	//////////////////////////////////////////////////
 	void Set(bool in);
 	//////////////////////////////////////////////////
+	/// \fn void Set(DependencyDataPackage in)
+	/// \brief Sets type and value of another DependencyDataPackage to data items
+	/// \param [in] in is the value to be set
+	///
+	/// - In case there is a change in type or value, static variable delta is incremented
+	//////////////////////////////////////////////////
+	void Set(DependencyDataPackage in);
+	//////////////////////////////////////////////////
+	/// \fn void SetInt(int64_t in)
+	/// \brief Sets an integer value (SmartDG_DATATYPE_INT)
+	/// \param [in] in is the value to be set
+	///
+	/// - In case there is a change in type or value, static variable delta is incremented
+	//////////////////////////////////////////////////
+	void SetInt(int64_t in);
+	//////////////////////////////////////////////////
+	/// \fn void SetReal(double in)
+	/// \brief Sets a double value (SmartDG_DATATYPE_REAL)
+	/// \param [in] in is the value to be set
+	///
+	/// - In case there is a change in type or value, static variable delta is incremented
+	//////////////////////////////////////////////////
+	void SetReal(double in);
+	//////////////////////////////////////////////////
+	/// \fn void SetEnum(unsigned int in)
+	/// \brief Sets an enumerator value (SmartDG_DATATYPE_ENUM)
+	/// \param [in] in is the value to be set
+	///
+	/// - In case there is a change in type or value, static variable delta is incremented
+	//////////////////////////////////////////////////
+	void SetEnum(unsigned int in);
+	//////////////////////////////////////////////////
+	/// \fn template<typename T> void SetStruct(const T &in)
+	/// \brief Sets a small struct value (SmartDG_DATATYPE_STRUCT)
+	/// \param [in] in is the value to be set (trivially copyable, at most 8 bytes)
+	///
+	/// - In case there is a change in type or value, static variable delta is incremented
+	//////////////////////////////////////////////////
+	template<typename T> void SetStruct(const T &in) {
+		static_assert(sizeof(T) <= sizeof(uint64_t), "SmartDG_DATATYPE_STRUCT exceeds 8 bytes");
+		static_assert(is_trivially_copyable<T>::value, "SmartDG_DATATYPE_STRUCT is not trivially copyable");
+		uint64_t bits = 0;
+		memcpy(&bits, &in, sizeof(T));
+		SetBits(SmartDG_DATATYPE_STRUCT, bits);
+	}
+	//////////////////////////////////////////////////
 	/// \fn bool Get()
 	/// \brief Gets value of data items
 	/// \return [bool] Value of the data item
 	///
-	/// - Returns value of data items
+	/// - Returns value of data items (boolean view for non boolean values)
 	//////////////////////////////////////////////////
 	bool Get();
 	//////////////////////////////////////////////////
+	/// \fn int64_t GetInt()
+	/// \brief Gets value as integer (SmartDG_DATATYPE_BOOL, SmartDG_DATATYPE_INT, SmartDG_DATATYPE_ENUM or truncated SmartDG_DATATYPE_REAL)
+	//////////////////////////////////////////////////
+	int64_t GetInt();
+	//////////////////////////////////////////////////
+	/// \fn double GetReal()
+	/// \brief Gets value as double (SmartDG_DATATYPE_REAL, or converted SmartDG_DATATYPE_BOOL, SmartDG_DATATYPE_INT, SmartDG_DATATYPE_ENUM)
+	//////////////////////////////////////////////////
+	double GetReal();
+	//////////////////////////////////////////////////
+	/// \fn unsigned int GetEnum()
+	/// \brief Gets value as enumerator
+	//////////////////////////////////////////////////
+	unsigned int GetEnum();
+	//////////////////////////////////////////////////
+	/// \fn template<typename T> T GetStruct()
+	/// \brief Gets value as small struct (payload bits of SmartDG_DATATYPE_STRUCT)
+	//////////////////////////////////////////////////
+	template<typename T> T GetStruct() {
+		static_assert(sizeof(T) <= sizeof(uint64_t), "SmartDG_DATATYPE_STRUCT exceeds 8 bytes");
+		static_assert(is_trivially_copyable<T>::value, "SmartDG_DATATYPE_STRUCT is not trivially copyable");
+		T out;
+		memcpy(&out, &v, sizeof(T));
+		return out;
+	}
+	//////////////////////////////////////////////////
+	/// \fn void SetBits(unsigned char t, uint64_t bits)
+	/// \brief Sets type and payload bits of a non boolean value
+	/// \param [in] t is the data type
+	/// \param [in] bits are the payload bits
+	///
+	/// - Sets DependencyDataPackage::b to true when bits are non zero\n
+	/// - In case there is a change in type or value, static variable delta is incremented
+	//////////////////////////////////////////////////
+	void SetBits(unsigned char t, uint64_t bits);
+	//////////////////////////////////////////////////
 	/// \fn string toStr()
 	/// \brief Gets value of data items converted to a string
 	/// \return [string] Value of the data item converted to a string
 	///
-	/// - Returns value of data items converted to string
+	/// - Returns "T" or "F" for SmartDG_DATATYPE_BOOL\n
+	/// - Returns boolean view, ':', type letter (i, d, e, x) and value for other types (e.g. "T:i42", "F:d0", "T:x00000000000000ff")
+	//////////////////////////////////////////////////
+	string toStr() const;
+	//////////////////////////////////////////////////
+	/// \fn bool operator==(const DependencyDataPackage &other) const
+	/// \brief Returns true if type and value of both DependencyDataPackage objects are equal
+	//////////////////////////////////////////////////
+	bool operator==(const DependencyDataPackage &other) const;
+	//////////////////////////////////////////////////
+	/// \fn bool operator!=(const DependencyDataPackage &other) const
+	/// \brief Returns true if type or value of DependencyDataPackage objects differ
 	//////////////////////////////////////////////////
-	string toStr();
+	bool operator!=(const DependencyDataPackage &other) const;
 	//////////////////////////////////////////////////
 	/// \fn ~DependencyDataPackage()
 	/// \brief Default Destructor
@@ -78,15 +176,19 @@ public:
 /// \param [in] var is an object of DependencyDataPackage
 /// \return [std::ostream] an ostream object that contains var converted to string
 ///
-/// - Doesn't Utilizes DependencyDataPackage::toStr() function for conversion\n
+/// - Doesn't Utilizes DependencyDataPackage::toStr() function for conversion of boolean values\n
 /// - Utilizes default << operators associated with ostream class for conversion\n
-/// - For example boolean true is converted to "1"(Default conversion) and not "T"(Using DependencyDataPackage::toStr())
+/// - For example boolean true is converted to "1"(Default conversion) and not "T"(Using DependencyDataPackage::toStr())\n
+/// - Non boolean values are converted using DependencyDataPackage::toStr()
 ///
 ////////////////////////////////////////////////////////////////////////////////
 inline std::ostream& operator <<(std::ostream& os,
 		const DependencyDataPackage& var) {
 	// Utilizes default << operators associated with ostream class for conversion
-	os << var.b;
+	if (var.type == SmartDG_DATATYPE_BOOL)
+		os << var.b;
+	else
+		os << var.toStr();
 	return os;
 }
 
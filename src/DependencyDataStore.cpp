@@ -0,0 +1,150 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyDataStore.cpp
+/// \brief	Source file for DependencyDataStore class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+
+// Mixes the bits of a key (splitmix64 finalizer)
+static inline uint64_t mix(uint64_t k) {
+	k = (k ^ (k >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	k = (k ^ (k >> 27)) * 0x94d049bb133111ebULL;
+	return k ^ (k >> 31);
+}
+
+DependencyDataStore::DependencyDataStore() {
+	version = 0;
+	slots.assign(64, 0);
+}
+
+unsigned int DependencyDataStore::Intern(string url) {
+	unordered_map<string, unsigned int>::iterator it = ids.find(url);
+	if (it != ids.end())
+		return it->second;
+	ids[url] = urls.size();
+	urls.push_back(url);
+	return urls.size() - 1;
+}
+
+unsigned int DependencyDataStore::Slot(uint64_t key) {
+	// Linear probing (slots.size() is a power of 2)
+	unsigned int mask = slots.size() - 1;
+	unsigned int s = mix(key) & mask;
+	while ((slots[s] != 0) && (keys[slots[s] - 1] != key))
+		s = (s + 1) & mask;
+	return s;
+}
+
+void DependencyDataStore::Grow() {
+	slots.assign(slots.size() * 2, 0);
+	for (unsigned int e = 0; e < keys.size(); e++)
+		slots[Slot(keys[e])] = e + 1;
+}
+
+int DependencyDataStore::Find(unsigned int from, unsigned int to) {
+	unsigned int s = Slot((uint64_t(from) << 32) | to);
+	return (int) slots[s] - 1;
+}
+
+void DependencyDataStore::Set(unsigned int from, unsigned int to,
+		DependencyDataPackage d) {
+	uint64_t key = (uint64_t(from) << 32) | to;
+	unsigned int s = Slot(key);
+	unsigned int e = slots[s];
+	if (e == 0) {
+		// New entry (load factor is kept at or below 1/2)
+		keys.push_back(key);
+		data.push_back(d);
+		versions.push_back(0);
+		e = keys.size() - 1;
+		slots[s] = e + 1;
+		if (2 * keys.size() > slots.size())
+			Grow();
+	} else {
+		e--;
+		if (data[e] == d)
+			return;
+		data[e] = d;
+	}
+	// Stamps the change
+	versions[e] = ++version;
+	log.push_back(e);
+	logv.push_back(version);
+	if (log.size() > 2 * keys.size() + 64)
+		Compact();
+}
+
+void DependencyDataStore::Set(string from, string to, DependencyDataPackage d) {
+	Set(Intern(from), Intern(to), d);
+}
+
+DependencyDataPackage DependencyDataStore::Get(unsigned int from,
+		unsigned int to) {
+	int e = Find(from, to);
+	if (e < 0)
+		return DependencyDataPackage();
+	return data[e];
+}
+
+DependencyDataPackage DependencyDataStore::Get(string from, string to) {
+	unordered_map<string, unsigned int>::iterator f = ids.find(from);
+	unordered_map<string, unsigned int>::iterator t = ids.find(to);
+	if ((f == ids.end()) || (t == ids.end()))
+		return DependencyDataPackage();
+	return Get(f->second, t->second);
+}
+
+unsigned long DependencyDataStore::Since(unsigned long v,
+		vector<unsigned int> &entries) {
+	entries.clear();
+	// First change after version v
+	unsigned int k = upper_bound(logv.begin(), logv.end(), v) - logv.begin();
+	for (; k < log.size(); k++)
+		// Skips stale repeats (the entry changed again later)
+		if (versions[log[k]] == logv[k])
+			entries.push_back(log[k]);
+	return version;
+}
+
+void DependencyDataStore::Compact() {
+	// Entries in the order of their last change
+	vector<unsigned int> order(keys.size());
+	for (unsigned int e = 0; e < keys.size(); e++)
+		order[e] = e;
+	sort(order.begin(), order.end(), [this](unsigned int a, unsigned int b) {
+		return versions[a] < versions[b];
+	});
+	log = order;
+	logv.resize(order.size());
+	for (unsigned int k = 0; k < order.size(); k++)
+		logv[k] = versions[order[k]];
+}
+
+unsigned int DependencyDataStore::From(unsigned int e) {
+	return keys[e] >> 32;
+}
+
+unsigned int DependencyDataStore::To(unsigned int e) {
+	return keys[e] & 0xffffffff;
+}
+
+unsigned int DependencyDataStore::size() {
+	return keys.size();
+}
+
+DependencyDataStore::~DependencyDataStore() {
+}
+
+} /* namespace SmartDG */
@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyDataStore.h
+/// \brief	Header file for DependencyDataStore class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DEPENDENCYDATASTORE_H_
+#define DEPENDENCYDATASTORE_H_
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+////////////////////////////////////////////////////////////////////////////////
+///	\class DependencyDataStore
+/// \brief DependencyDataStore class is the versioned global store of udi (Dependency Object's Unique Dependency Instances) values
+///
+/// URL strings are interned once (Intern()) into dense URL ids. An entry is keyed by the pair
+/// (URL id of the udi, URL id of its correspondent) and found in an open addressing hash table
+/// (linear probing), so that a lookup by ids costs no string compare.\n
+/// Every change of an entry increments DependencyDataStore::version and stamps the entry with it.
+/// A change log kept in version order lets readers fetch only the entries changed since a version
+/// they have seen (Since()), instead of re-reading the whole store.
+/// \see SmartDG_GlobalData::GlobalPackage
+////////////////////////////////////////////////////////////////////////////////
+class DependencyDataStore {
+private:
+	vector<unsigned int> slots; ///< Open addressing hash table: entry index + 1 for every slot (0 : empty)
+	vector<unsigned int> log; ///< Entry index of every change in version order (may hold stale repeats)
+	vector<unsigned long> logv; ///< Version of every change in DependencyDataStore::log
+	//////////////////////////////////////////////////
+	/// \fn unsigned int Slot(uint64_t key)
+	/// \brief Returns the slot holding key or the empty slot where key belongs
+	//////////////////////////////////////////////////
+	unsigned int Slot(uint64_t key);
+	//////////////////////////////////////////////////
+	/// \fn void Grow()
+	/// \brief Doubles DependencyDataStore::slots and re-inserts all entries
+	//////////////////////////////////////////////////
+	void Grow();
+	//////////////////////////////////////////////////
+	/// \fn void Compact()
+	/// \brief Rebuilds the change log with one change per entry
+	//////////////////////////////////////////////////
+	void Compact();
+public:
+	vector<string> urls; ///< Interned URL::str for every URL id
+	unordered_map<string, unsigned int> ids; ///< A hash map from URL::str to URL id
+	vector<uint64_t> keys; ///< Key ((URL id of udi) << 32 | URL id of correspondent) of every entry
+	vector<DependencyDataPackage> data; ///< Value of every entry
+	vector<unsigned long> versions; ///< Version of the last change of every entry
+	unsigned long version; ///< Version of the last change in the store (0 : no change yet)
+	//////////////////////////////////////////////////
+	/// \fn DependencyDataStore()
+	/// \brief Constructor
+	//////////////////////////////////////////////////
+	DependencyDataStore();
+	//////////////////////////////////////////////////
+	/// \fn unsigned int Intern(string url)
+	/// \brief Returns the URL id of a URL string, adding it if new
+	/// \param [in] url is URL::str
+	//////////////////////////////////////////////////
+	unsigned int Intern(string url);
+	//////////////////////////////////////////////////
+	/// \fn int Find(unsigned int from, unsigned int to)
+	/// \brief Finds an entry
+	/// \param [in] from is URL id of the udi
+	/// \param [in] to is URL id of the correspondent
+	/// \return [int] entry index or -1 if not found
+	//////////////////////////////////////////////////
+	int Find(unsigned int from, unsigned int to);
+	//////////////////////////////////////////////////
+	/// \fn void Set(unsigned int from, unsigned int to, DependencyDataPackage d)
+	/// \brief Sets an entry, adding it if new
+	/// \param [in] from is URL id of the udi
+	/// \param [in] to is URL id of the correspondent
+	/// \param [in] d is the value
+	///
+	/// - Increments DependencyDataStore::version and stamps the entry only if the entry is new or its value changed
+	///
+	/// \see Set(string from, string to, DependencyDataPackage d)
+	//////////////////////////////////////////////////
+	void Set(unsigned int from, unsigned int to, DependencyDataPackage d);
+	//////////////////////////////////////////////////
+	/// \fn void Set(string from, string to, DependencyDataPackage d)
+	/// \brief Sets an entry by URL strings (interned on the way)
+	/// \see Set(unsigned int from, unsigned int to, DependencyDataPackage d)
+	//////////////////////////////////////////////////
+	void Set(string from, string to, DependencyDataPackage d);
+	//////////////////////////////////////////////////
+	/// \fn DependencyDataPackage Get(unsigned int from, unsigned int to)
+	/// \brief Returns the value of an entry (a default DependencyDataPackage if not found)
+	/// \param [in] from is URL id of the udi
+	/// \param [in] to is URL id of the correspondent
+	/// \see Get(string from, string to)
+	//////////////////////////////////////////////////
+	DependencyDataPackage Get(unsigned int from, unsigned int to);
+	//////////////////////////////////////////////////
+	/// \fn DependencyDataPackage Get(string from, string to)
+	/// \brief Returns the value of an entry by URL strings (a default DependencyDataPackage if not found)
+	/// \see Get(unsigned int from, unsigned int to)
+	//////////////////////////////////////////////////
+	DependencyDataPackage Get(string from, string to);
+	//////////////////////////////////////////////////
+	/// \fn unsigned long Since(unsigned long v, vector<unsigned int> &entries)
+	/// \brief Lists the entries changed after version v
+	/// \param [in] v is a version returned by an earlier call (0 : all entries)
+	/// \param [out] entries are the entry indexes, each listed once, in the order of their last change
+	/// \return [unsigned long] DependencyDataStore::version, to be passed as v in the next call
+	///
+	/// - Costs O(log(changes) + changes since v)
+	///
+	//////////////////////////////////////////////////
+	unsigned long Since(unsigned long v, vector<unsigned int> &entries);
+	//////////////////////////////////////////////////
+	/// \fn unsigned int From(unsigned int e)
+	/// \brief Returns URL id of the udi of entry e
+	//////////////////////////////////////////////////
+	unsigned int From(unsigned int e);
+	//////////////////////////////////////////////////
+	/// \fn unsigned int To(unsigned int e)
+	/// \brief Returns URL id of the correspondent of entry e
+	//////////////////////////////////////////////////
+	unsigned int To(unsigned int e);
+	//////////////////////////////////////////////////
+	/// \fn unsigned int size()
+	/// \brief Returns number of entries
+	//////////////////////////////////////////////////
+	unsigned int size();
+	//////////////////////////////////////////////////
+	/// \fn ~DependencyDataStore()
+	/// \brief Default Destructor
+	//////////////////////////////////////////////////
+	virtual ~DependencyDataStore();
+};
+
+} /* namespace SmartDG */
+
+#endif /* DEPENDENCYDATASTORE_H_ */
@@ -20,92 +20,167 @@ namespace SmartDG {
 DependencyGraph::DependencyGraph() {
 	// Sets Default Name
 	Name = "NA_DG";
+	Values = make_shared<DependencyDataBuffer>();
 }
 
 DependencyGraph::DependencyGraph(string GraphName) {
 	// Sets Name to GraphName
 	Name = GraphName;
+	Values = make_shared<DependencyDataBuffer>();
+}
+
+DependencyGraph::DependencyGraph(const DependencyGraph &from) {
+	*this = from;
+}
+
+DependencyGraph& DependencyGraph::operator=(const DependencyGraph &from) {
+	// Copies all members
+	Name = from.Name;
+	DN = from.DN;
+	ult = from.ult;
+	ultio = from.ultio;
+	ultp = from.ultp;
+	uli = from.uli;
+	dobjs = from.dobjs;
+	View = from.View;
+	DOI = from.DOI;
+	SCC = from.SCC;
+	SCCIndex = from.SCCIndex;
+	SCCCyclic = from.SCCCyclic;
+	Values = make_shared<DependencyDataBuffer>(*from.Values);
+	Changes = from.Changes;
+	Stats = from.Stats;
+	SyncFrom = from.SyncFrom;
+	SyncTo = from.SyncTo;
+	SyncIndex = from.SyncIndex;
+	LiteKeys = from.LiteKeys;
+	LiteAllKeys = from.LiteAllKeys;
+	// Points udb of every DependencyObject in DN to Values
+	BindValues();
+	return *this;
+}
+
+void DependencyGraph::BindValues() {
+	for (unsigned int n = 0; n < DN.size(); n++)
+		for (unsigned int io = 0; io < DN[n].DP.size(); io++)
+			for (unsigned int p = 0; p < DN[n].DP[io].size(); p++)
+				for (unsigned int o = 0; o < DN[n].DP[io][p].DO.size(); o++)
+					DN[n].DP[io][p].DO[o].udb = Values.get();
+}
+
+void DependencyGraph::ShareValues(const DependencyGraph &from) {
+	Values = from.Values;
+	BindValues();
+}
+
+bool DependencyGraph::SharesValues() {
+	return Values.use_count() > 1;
 }
 
 void DependencyGraph::Generate_URLs() {
+	ult.clear();
+	ultio.clear();
+	ultp.clear();
+	uli.clear();
 	// For all DependencyNode objects in DN
 	for (unsigned int i = 0; i < DN.size(); i++) {
 		// For Input and Output ports of DependencyNode
 		for (unsigned int j = 0; j < DN[i].DP.size(); j++) {
+			// Offset of the first DependencyPort of DependencyNode i in Input or Output ports
+			ultio.push_back(ultp.size());
 			// For all DependencyPort objects in Input or Output port
 			for (unsigned int k = 0; k < DN[i].DP[j].size(); k++) {
+				// Offset of the first DependencyObject of DependencyPort k
+				ultp.push_back(ult.size());
 				// For all DependencyObject objects in DependencyPort
 				for (unsigned int l = 0; l < DN[i].DP[j][k].DO.size(); l++) {
 					// Generating URL for DependencyObject
 					DN[i].DP[j][k].DO[l].url = URL(i, j, k, l);
-					// Sets URL objects for all Input DependencyPort DependencyObject objects
-					if (j == 0) {
-						// Setting strn, strio, strp, stro and str for URL
-						DN[i].DP[j][k].DO[l].url.strn = DN[i].Name;
-						DN[i].DP[j][k].DO[l].url.strio = "In";
-						DN[i].DP[j][k].DO[l].url.strp = DN[i].DP[j][k].Name;
-						DN[i].DP[j][k].DO[l].url.stro =
-								DN[i].DP[j][k].DO[l].Name;
-						DN[i].DP[j][k].DO[l].url.str = DN[i].Name + ".In."
-								+ DN[i].DP[j][k].Name + "."
-								+ DN[i].DP[j][k].DO[l].Name;
-						// Fills ulm (URL list map) for all DependencyObject URLs
-						ulm[DN[i].Name]["In"][DN[i].DP[j][k].Name][DN[i].DP[j][k].DO[l].Name] =
-								DN[i].DP[j][k].DO[l].url;
-						// Fills ulmi (URL list map integer) for all DependencyObject URLs
-						ulmi[i][0][k][l] = DN[i].DP[j][k].DO[l].url;
-					}
-					// Sets URL objects for all Output DependencyPort DependencyObject objects
-					else {
-						// Setting strn, strio, strp, stro and str for URL
-						DN[i].DP[j][k].DO[l].url.strn = DN[i].Name;
-						DN[i].DP[j][k].DO[l].url.strio = "Out";
-						DN[i].DP[j][k].DO[l].url.strp = DN[i].DP[j][k].Name;
-						DN[i].DP[j][k].DO[l].url.stro =
-								DN[i].DP[j][k].DO[l].Name;
-						DN[i].DP[j][k].DO[l].url.str = DN[i].Name + ".Out."
-								+ DN[i].DP[j][k].Name + "."
-								+ DN[i].DP[j][k].DO[l].Name;
-						// Fills ulm (URL list map) for all DependencyObject URLs
-						ulm[DN[i].Name]["Out"][DN[i].DP[j][k].Name][DN[i].DP[j][k].DO[l].Name] =
-								DN[i].DP[j][k].DO[l].url;
-						// Fills ulmi (URL list map integer) for all DependencyObject URLs
-						ulmi[i][1][k][l] = DN[i].DP[j][k].DO[l].url;
-					}
+					// Setting strn, strio, strp, stro and str for URL
+					DN[i].DP[j][k].DO[l].url.setNames(DN[i].Name,
+							(j == 0) ? "In" : "Out", DN[i].DP[j][k].Name,
+							DN[i].DP[j][k].DO[l].Name);
+					// Fills uli (URL list index) and ult (URL list table) for all DependencyObject URLs
+					uli[DN[i].DP[j][k].DO[l].url.str()] = ult.size();
+					ult.push_back(DN[i].DP[j][k].DO[l].url);
 				}
 			}
 		}
+		// DependencyNode objects without Output ports still take two ultio entries
+		for (unsigned int j = DN[i].DP.size(); j < 2; j++)
+			ultio.push_back(ultp.size());
 	}
+	// Closing entries
+	ultio.push_back(ultp.size());
+	ultp.push_back(ult.size());
+}
+
+int DependencyGraph::URLId(string str) {
+	unordered_map<string, unsigned int>::const_iterator it = uli.find(str);
+	if (it == uli.end())
+		return -1;
+	return it->second;
+}
+
+int DependencyGraph::URLId(unsigned int ni, unsigned int ioi, unsigned int pi,
+		unsigned int oi) {
+	if ((ni >= DN.size()) || (ioi > 1))
+		return -1;
+	unsigned int row = ultio[2 * ni + ioi] + pi;
+	if (row >= ultio[2 * ni + ioi + 1])
+		return -1;
+	unsigned int id = ultp[row] + oi;
+	if (id >= ultp[row + 1])
+		return -1;
+	return id;
 }
 
-void DependencyGraph::AddDependency(string name, string fni, string fpi,
+bool DependencyGraph::AddDependency(string name, string fni, string fpi,
 		string foi, string tni, string tpi, string toi) {
+	// Resolves source and target URLs through uli (no entries are created for unknown names)
+	int f = URLId(fni + ".Out." + fpi + "." + foi);
+	int t = URLId(tni + ".In." + tpi + "." + toi);
+	if ((f < 0) || (t < 0)) {
+		cout << "ERROR[URL NOT FOUND]: " << name << " : " << fni << ".Out."
+				<< fpi << "." << foi << " --> " << tni << ".In." << tpi << "."
+				<< toi << endl;
+		return false;
+	}
 	// Makes a Dependency object tmp
-	Dependency tmp(name, ulm[fni]["Out"][fpi][foi], ulm[tni]["In"][tpi][toi]);
+	Dependency tmp(name, ult[f], ult[t]);
+	// Sets TF and FT registered for the Connector type
+	DependencyConnector::Assign(tmp);
 	// Calls AddDependency(Dependency &tmp)
 	AddDependency(tmp);
+	return true;
 }
 
-void DependencyGraph::AddDependency(string name, DependencyNode fn,
+bool DependencyGraph::AddDependency(string name, DependencyNode fn,
 		DependencyPort fp, DependencyObject ob, DependencyNode tn,
 		DependencyPort tp) {
-	// Makes a Dependency object tmp
-	Dependency tmp(name, ulm[fn.Name]["Out"][fp.Name][ob.Name],
-			ulm[tn.Name]["In"][tp.Name][ob.Name]);
-	// Calls AddDependency(Dependency &tmp)
-	AddDependency(tmp);
+	// Calls AddDependency(string name, string fni, string fpi, string foi, string tni, string tpi, string toi)
+	return AddDependency(name, fn.Name, fp.Name, ob.Name, tn.Name, tp.Name,
+			ob.Name);
 }
 
 void DependencyGraph::AddDependency(Dependency &tmp) {
 	// Finds DependencyObject object's Name and sets obName to it
 	string obName =
 			DN[tmp.From.NodeIndex].DP[tmp.From.InOutIndex][tmp.From.PortIndex].DO[tmp.From.ObjectIndex].Name;
+	DependencyObject &fo =
+			DN[tmp.From.NodeIndex].DP[tmp.From.InOutIndex][tmp.From.PortIndex].DO[tmp.From.ObjectIndex];
+	DependencyObject &to =
+			DN[tmp.To.NodeIndex].DP[tmp.To.InOutIndex][tmp.To.PortIndex].DO[tmp.To.ObjectIndex];
+	// Sets Dependency::id to the next dense dependency index
+	tmp.id = Values->size() / 2;
 	// Adds a new udi entry (Dependency Object's Unique Dependency Instance) in Source Node and sets its default value
-	DN[tmp.From.NodeIndex].DP[tmp.From.InOutIndex][tmp.From.PortIndex].DO[tmp.From.ObjectIndex].udi[tmp.To.str] =
-			DN[tmp.From.NodeIndex].DP[tmp.From.InOutIndex][tmp.From.PortIndex].DO[tmp.From.ObjectIndex].defaultdata;
+	Values->Add(fo.defaultdata);
+	fo.AddInstance(tmp.To.str(), tmp.FromValue());
+	fo.udb = Values.get();
 	// Adds a new udi entry (Dependency Object's Unique Dependency Instance) in Target Node and sets its default value
-	DN[tmp.To.NodeIndex].DP[tmp.To.InOutIndex][tmp.To.PortIndex].DO[tmp.To.ObjectIndex].udi[tmp.From.str] =
-			DN[tmp.To.NodeIndex].DP[tmp.To.InOutIndex][tmp.To.PortIndex].DO[tmp.To.ObjectIndex].defaultdata;
+	Values->Add(to.defaultdata);
+	to.AddInstance(tmp.From.str(), tmp.ToValue());
+	to.udb = Values.get();
 	// Add DependencyObject object to dobjs if not already present in View
 	if (View.find(obName) == View.end())
 		dobjs.push_back(obName);
@@ -115,6 +190,81 @@ void DependencyGraph::AddDependency(Dependency &tmp) {
 	View[obName].push_back(tmp);
 }
 
+void DependencyGraph::Generate_SCC() {
+	SCC.clear();
+	SCCIndex.clear();
+	SCCCyclic.clear();
+	for (map<string, vector<Dependency> >::const_iterator it = View.begin();
+			it != View.end(); ++it) {
+		string ob = it->first;
+		// Builds the graph formed by DN and View[ob] (Source to Target)
+		vector<vector<unsigned int> > next(DN.size());
+		vector<bool> selfloop(DN.size(), false);
+		for (unsigned int i = 0; i < it->second.size(); i++) {
+			unsigned int f = it->second[i].From.NodeIndex;
+			unsigned int t = it->second[i].To.NodeIndex;
+			next[f].push_back(t);
+			if (f == t)
+				selfloop[f] = true;
+		}
+		// Finds strongly connected components (Tarjan, without recursion)
+		vector<int> index(DN.size(), -1);
+		vector<int> low(DN.size(), 0);
+		vector<bool> onstack(DN.size(), false);
+		vector<unsigned int> stack;
+		vector<pair<unsigned int, unsigned int> > call; // DependencyNode index, next successor
+		vector<vector<unsigned int> > found; // Reverse topological order
+		int counter = 0;
+		for (unsigned int r = 0; r < DN.size(); r++) {
+			if (index[r] != -1)
+				continue;
+			index[r] = low[r] = counter++;
+			stack.push_back(r);
+			onstack[r] = true;
+			call.push_back(make_pair(r, 0));
+			while (!call.empty()) {
+				unsigned int v = call.back().first;
+				if (call.back().second < next[v].size()) {
+					unsigned int w = next[v][call.back().second++];
+					if (index[w] == -1) {
+						index[w] = low[w] = counter++;
+						stack.push_back(w);
+						onstack[w] = true;
+						call.push_back(make_pair(w, 0));
+					} else if (onstack[w])
+						low[v] = min(low[v], index[w]);
+					continue;
+				}
+				call.pop_back();
+				if (!call.empty())
+					low[call.back().first] = min(low[call.back().first],
+							low[v]);
+				if (low[v] == index[v]) {
+					vector<unsigned int> component;
+					unsigned int w;
+					do {
+						w = stack.back();
+						stack.pop_back();
+						onstack[w] = false;
+						component.push_back(w);
+					} while (w != v);
+					sort(component.begin(), component.end());
+					found.push_back(component);
+				}
+			}
+		}
+		// Stores components in topological order and fills SCCIndex and SCCCyclic
+		SCCIndex[ob].resize(DN.size());
+		for (unsigned int s = found.size(); s-- > 0;) {
+			SCC[ob].push_back(found[s]);
+			SCCCyclic[ob].push_back(
+					(found[s].size() > 1) || selfloop[found[s][0]]);
+			for (unsigned int k = 0; k < found[s].size(); k++)
+				SCCIndex[ob][found[s][k]] = SCC[ob].size() - 1;
+		}
+	}
+}
+
 void DependencyGraph::Display() {
 	// Calls DependencyNode::Display function for each DependencyNode in DN
 	for (unsigned int i = 0; i < DN.size(); i++)
@@ -128,55 +278,13 @@ void DependencyGraph::Display_URLs() {
 	}
 }
 
-void DependencyGraph::Display_ulm() {
-	// Displays the complete ulm (URL list map)
-	for (unsigned int i = 0; i < DN.size(); i++) {
-		for (unsigned int j = 0; j < DN[i].DP.size(); j++) {
-			for (unsigned int k = 0; k < DN[i].DP[j].size(); k++) {
-				for (unsigned int l = 0; l < DN[i].DP[j][k].DO.size(); l++) {
-					DN[i].DP[j][k].DO[l].url = URL(i, j, k, l);
-					if (j == 0) {
-						cout << "[" << DN[i].Name << "][In]["
-								<< DN[i].DP[j][k].Name << "]["
-								<< DN[i].DP[j][k].DO[l].Name << "] ";
-						cout << "[" << i << "][0][" << k << "][" << l << "] ";
-						ulm[DN[i].Name]["In"][DN[i].DP[j][k].Name][DN[i].DP[j][k].DO[l].Name].Display();
-					} else {
-						cout << "[" << DN[i].Name << "][Out]["
-								<< DN[i].DP[j][k].Name << "]["
-								<< DN[i].DP[j][k].DO[l].Name << "] ";
-						cout << "[" << i << "][1][" << k << "][" << l << "] ";
-						ulm[DN[i].Name]["Out"][DN[i].DP[j][k].Name][DN[i].DP[j][k].DO[l].Name].Display();
-					}
-				}
-			}
-		}
-	}
-}
-
-void DependencyGraph::Display_ulmi() {
-	// Displays the complete ulmi (URL list map integer)
-	for (unsigned int i = 0; i < DN.size(); i++) {
-		for (unsigned int j = 0; j < DN[i].DP.size(); j++) {
-			for (unsigned int k = 0; k < DN[i].DP[j].size(); k++) {
-				for (unsigned int l = 0; l < DN[i].DP[j][k].DO.size(); l++) {
-					DN[i].DP[j][k].DO[l].url = URL(i, j, k, l);
-					if (j == 0) {
-						cout << "[" << DN[i].Name << "][In]["
-								<< DN[i].DP[j][k].Name << "]["
-								<< DN[i].DP[j][k].DO[l].Name << "] ";
-						cout << "[" << i << "][0][" << k << "][" << l << "] ";
-						ulmi[i][0][k][l].Display();
-					} else {
-						cout << "[" << DN[i].Name << "][Out]["
-								<< DN[i].DP[j][k].Name << "]["
-								<< DN[i].DP[j][k].DO[l].Name << "] ";
-						cout << "[" << i << "][1][" << k << "][" << l << "] ";
-						ulmi[i][1][k][l].Display();
-					}
-				}
-			}
-		}
+void DependencyGraph::Display_ult() {
+	// Displays the complete ult (URL list table) with URL ids
+	for (unsigned int id = 0; id < ult.size(); id++) {
+		cout << "[" << ult[id].strn() << "][" << ult[id].strio() << "]["
+				<< ult[id].strp() << "][" << ult[id].stro() << "] ";
+		cout << "<" << id << "> ";
+		ult[id].Display();
 	}
 }
 
@@ -216,6 +324,256 @@ void DependencyGraph::DisplayDependencyValues() {
 	}
 }
 
+void DependencyGraph::Display_SCC() {
+	// Displays SCC of all DependencyObject names in View in topological order
+	for (map<string, vector<vector<unsigned int> > >::const_iterator it =
+			SCC.begin(); it != SCC.end(); ++it) {
+		std::cout << "SCC_" << it->first << endl;
+		for (unsigned int s = 0; s < it->second.size(); s++) {
+			cout << SCCStr(it->first, s);
+			// Cyclic components are marked with *
+			if (SCCCyclic[it->first][s])
+				cout << " *";
+			cout << endl;
+		}
+	}
+}
+
+string DependencyGraph::SCCStr(string ob, unsigned int s) {
+	string str = "SCC " + to_string(s) + " {";
+	for (unsigned int k = 0; k < SCC[ob][s].size(); k++) {
+		if (k > 0)
+			str += ", ";
+		str += DN[SCC[ob][s][k]].Name;
+	}
+	return str + "}";
+}
+
+bool DependencyGraph::Solve(string obj, int direction,
+		DependencyGraphObserver *observer) {
+	map<string, vector<Dependency> >::iterator it = View.find(obj);
+	if (it == View.end())
+		return true;
+	// Seeds every Connector of the View and every DependencyNode
+	vector<bool> dirtyConnector(it->second.size(), true);
+	vector<bool> dirtyNode(DN.size(), true);
+	return Solve(obj, direction, dirtyConnector, dirtyNode, observer);
+}
+
+bool DependencyGraph::Solve(string obj, int direction,
+		vector<bool> &dirtyConnector, vector<bool> &dirtyNode,
+		DependencyGraphObserver *observer) {
+	bool converged = Solve(obj, direction, dirtyConnector, dirtyNode, *Values,
+			Changes, Stats, observer);
+	if (observer != NULL)
+		observer->Solved(*this, obj, direction, converged);
+	return converged;
+}
+
+bool DependencyGraph::Solve(string obj, int direction,
+		DependencyDataBuffer &values, DependencyDataChanges &changes,
+		DependencySolveStats &stats) {
+	map<string, vector<Dependency> >::iterator it = View.find(obj);
+	if (it == View.end())
+		return true;
+	// Seeds every Connector of the View and every DependencyNode
+	vector<bool> dirtyConnector(it->second.size(), true);
+	vector<bool> dirtyNode(DN.size(), true);
+	return Solve(obj, direction, dirtyConnector, dirtyNode, values, changes,
+			stats, NULL);
+}
+
+bool DependencyGraph::Solve(string obj, int direction,
+		vector<bool> &dirtyConnector, vector<bool> &dirtyNode,
+		DependencyDataBuffer &values, DependencyDataChanges &changes,
+		DependencySolveStats &stats, DependencyGraphObserver *observer) {
+	// Records changes and counters of this solve only
+	changes.Reset();
+	values.Track(&changes);
+	stats.Reset(obj, direction);
+	stats.solves = 1;
+	// DependencyObjects read and write values on this thread
+	DependencyDataBuffer *previous = DependencyObject::bound;
+	DependencyObject::bound = &values;
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	bool converged;
+	if (SmartDG_TOPOLOGICAL_SOLVER && (SCC.find(obj) != SCC.end()))
+		converged = SolveTopological(obj, direction, dirtyConnector,
+				dirtyNode, changes, stats, observer);
+	else
+		converged = SolvePasses(obj, direction, dirtyConnector, dirtyNode,
+				changes, stats, observer);
+	DependencyObject::bound = previous;
+	values.Track(NULL);
+	stats.time = chrono::duration<double>(
+			chrono::steady_clock::now() - start).count();
+	stats.changes = changes.count;
+	stats.converged = converged;
+	return converged;
+}
+
+bool DependencyGraph::SolveConnector(vector<Dependency> &V, unsigned int i,
+		int direction, DependencyDataChanges &changes,
+		DependencySolveStats &stats, DependencyGraphObserver *observer) {
+	Dependency &d = V[i];
+	unsigned long before = changes.count;
+	if ((direction > 0) && d.TF)
+		d.TF(DN[d.From.NodeIndex].DP, DN[d.To.NodeIndex].DP, d);
+	if ((direction < 0) && d.FT)
+		d.FT(DN[d.From.NodeIndex].DP, DN[d.To.NodeIndex].DP, d);
+	d.direction = direction;
+	bool changed = (changes.count != before);
+	stats.CountConnector(d.id, changed);
+	if (observer != NULL)
+		observer->SolvedConnector(d, direction, changed);
+	return changed;
+}
+
+bool DependencyGraph::SolveNode(unsigned int j, int direction,
+		DependencyDataChanges &changes, DependencySolveStats &stats,
+		DependencyGraphObserver *observer) {
+	unsigned long before = changes.count;
+	// Per call timing only if compiled in, Solve() times the whole solve
+	chrono::steady_clock::time_point start;
+	if (SmartDG_SOLVE_NODE_TIMING)
+		start = chrono::steady_clock::now();
+	if (direction > 0)
+		DN[j].TFT.CallTF(DN[j].DP, DN[j].Handles);
+	if (direction < 0)
+		DN[j].TFT.CallFT(DN[j].DP, DN[j].Handles);
+	bool changed = (changes.count != before);
+	double seconds = 0;
+	if (SmartDG_SOLVE_NODE_TIMING)
+		seconds = chrono::duration<double>(
+				chrono::steady_clock::now() - start).count();
+	stats.CountNode(j, changed, seconds);
+	if (observer != NULL)
+		observer->SolvedNode(DN[j], direction, changed);
+	return changed;
+}
+
+bool DependencyGraph::SolvePasses(string obj, int direction,
+		vector<bool> &dirtyConnector, vector<bool> &dirtyNode,
+		DependencyDataChanges &changes, DependencySolveStats &stats,
+		DependencyGraphObserver *observer) {
+	vector<Dependency> &V = View[obj];
+	// Connectors of the View touching each DependencyNode
+	vector<vector<unsigned int> > adjacent(DN.size());
+	for (unsigned int i = 0; i < V.size(); i++) {
+		adjacent[V[i].From.NodeIndex].push_back(i);
+		if (V[i].To.NodeIndex != V[i].From.NodeIndex)
+			adjacent[V[i].To.NodeIndex].push_back(i);
+	}
+	// Call dirty Connector TFs and dirty Component TFs till the worklist is empty
+	for (unsigned int loop = 0;
+			loop < SmartDG_CIRCULAR_DEPENDENCY_BREAKOUT_COUNT; loop++) {
+		unsigned int pending = 0;
+		stats.passes = loop + 1;
+		// Call dirty Connector TFs
+		for (unsigned int i = 0; i < V.size(); i++) {
+			if (!dirtyConnector[i])
+				continue;
+			dirtyConnector[i] = false;
+			if (SolveConnector(V, i, direction, changes, stats, observer)) {
+				if (direction > 0)
+					dirtyNode[V[i].To.NodeIndex] = true;
+				if (direction < 0)
+					dirtyNode[V[i].From.NodeIndex] = true;
+			}
+		}
+		// Call dirty Component TFs
+		for (unsigned int j = 0; j < DN.size(); j++) {
+			if (!dirtyNode[j])
+				continue;
+			dirtyNode[j] = false;
+			if (SolveNode(j, direction, changes, stats, observer)) {
+				for (unsigned int k = 0; k < adjacent[j].size(); k++) {
+					if (!dirtyConnector[adjacent[j][k]])
+						pending++;
+					dirtyConnector[adjacent[j][k]] = true;
+				}
+			}
+		}
+		if (pending == 0)
+			return true;
+	}
+	cout << "ERROR[CIRCULAR_DEPENDENCY_BREAKOUT_COUNT]: Reached" << endl;
+	stats.breakouts++;
+	return false;
+}
+
+bool DependencyGraph::SolveTopological(string obj, int direction,
+		vector<bool> &dirtyConnector, vector<bool> &dirtyNode,
+		DependencyDataChanges &changes, DependencySolveStats &stats,
+		DependencyGraphObserver *observer) {
+	vector<Dependency> &V = View[obj];
+	vector<vector<unsigned int> > &C = SCC[obj];
+	bool converged = true;
+	// Connectors grouped by the component they write to and by the DependencyNode they read from
+	vector<vector<unsigned int> > incoming(C.size());
+	vector<vector<unsigned int> > reading(DN.size());
+	for (unsigned int i = 0; i < V.size(); i++) {
+		unsigned int w = V[i].To.NodeIndex;
+		unsigned int r = V[i].From.NodeIndex;
+		if (direction < 0)
+			swap(w, r);
+		incoming[SCCIndex[obj][w]].push_back(i);
+		reading[r].push_back(i);
+	}
+	for (unsigned int n = 0; n < C.size(); n++) {
+		// Components in topological order for TF and in reverse order for FT
+		unsigned int s = (direction < 0) ? C.size() - 1 - n : n;
+		unsigned int loop = 0;
+		while (true) {
+			stats.passes = max(stats.passes, loop + 1);
+			// Call dirty incoming Connector TFs
+			for (unsigned int k = 0; k < incoming[s].size(); k++) {
+				unsigned int i = incoming[s][k];
+				if (!dirtyConnector[i])
+					continue;
+				dirtyConnector[i] = false;
+				if (SolveConnector(V, i, direction, changes, stats,
+						observer)) {
+					if (direction > 0)
+						dirtyNode[V[i].To.NodeIndex] = true;
+					if (direction < 0)
+						dirtyNode[V[i].From.NodeIndex] = true;
+				}
+			}
+			// Call dirty Component TFs
+			for (unsigned int k = 0; k < C[s].size(); k++) {
+				unsigned int j = C[s][k];
+				if (!dirtyNode[j])
+					continue;
+				dirtyNode[j] = false;
+				if (SolveNode(j, direction, changes, stats, observer))
+					for (unsigned int l = 0; l < reading[j].size(); l++)
+						dirtyConnector[reading[j][l]] = true;
+			}
+			// An acyclic component is solved in a single pass
+			if (!SCCCyclic[obj][s])
+				break;
+			bool pending = false;
+			for (unsigned int k = 0; k < incoming[s].size(); k++)
+				if (dirtyConnector[incoming[s][k]])
+					pending = true;
+			if (!pending)
+				break;
+			if (++loop == SmartDG_CIRCULAR_DEPENDENCY_BREAKOUT_COUNT) {
+				cout << "ERROR[CIRCULAR_DEPENDENCY_BREAKOUT_COUNT]: Reached in "
+						<< SCCStr(obj, s) << endl;
+				converged = false;
+				stats.breakouts++;
+				// Continue downstream with the values reached so far
+				for (unsigned int k = 0; k < incoming[s].size(); k++)
+					dirtyConnector[incoming[s][k]] = false;
+				break;
+			}
+		}
+	}
+	return converged;
+}
+
 DependencyGraph::~DependencyGraph() {
 }
 
@@ -29,34 +29,157 @@ namespace SmartDG {
 ///  and  display the aforementioned  entities.
 ////////////////////////////////////////////////////////////////////////////////
 class DependencyGraph {
+private:
+	//////////////////////////////////////////////////
+	/// \fn bool SolveConnector(vector<Dependency> &V, unsigned int i, int direction, DependencyDataChanges &changes, DependencySolveStats &stats, DependencyGraphObserver *observer)
+	/// \brief Calls TF (FT) of Connector V[i] according to direction and sets its Dependency::direction
+	/// \param [in] V is the View (View[obj], resolved once per solve)
+	/// \param [in] i is index of the Dependency object in V
+	/// \param [in] direction is 1 for TF and -1 for FT
+	/// \param [in] changes records the changes of the solve
+	/// \param [in,out] stats counts the call
+	/// \param [in] observer receives DependencyGraphObserver::SolvedConnector() (may be NULL)
+	/// \return [bool] true if any value was changed (recorded in changes)
+	//////////////////////////////////////////////////
+	bool SolveConnector(vector<Dependency> &V, unsigned int i, int direction,
+			DependencyDataChanges &changes, DependencySolveStats &stats,
+			DependencyGraphObserver *observer);
+	//////////////////////////////////////////////////
+	/// \fn bool SolveNode(unsigned int j, int direction, DependencyDataChanges &changes, DependencySolveStats &stats, DependencyGraphObserver *observer)
+	/// \brief Calls TFT.CallTF() (TFT.CallFT()) of DependencyNode DN[j] according to direction
+	/// \param [in] j is index of the DependencyNode object in DN
+	/// \param [in] direction is 1 for TF and -1 for FT
+	/// \param [in] changes records the changes of the solve
+	/// \param [in,out] stats counts the call
+	/// \param [in] observer receives DependencyGraphObserver::SolvedNode() (may be NULL)
+	/// \return [bool] true if any value was changed (recorded in changes)
+	//////////////////////////////////////////////////
+	bool SolveNode(unsigned int j, int direction, DependencyDataChanges &changes,
+			DependencySolveStats &stats, DependencyGraphObserver *observer);
+	//////////////////////////////////////////////////
+	/// \fn bool SolvePasses(string obj, int direction, vector<bool> &dirtyConnector, vector<bool> &dirtyNode, DependencyDataChanges &changes, DependencySolveStats &stats, DependencyGraphObserver *observer)
+	/// \brief Propagates the worklist in passes over the whole View
+	/// \param [in] obj is DependencyObject name of the View
+	/// \param [in] direction is 1 for TF and -1 for FT
+	/// \param [in,out] dirtyConnector flags Connectors of View[obj] to be called
+	/// \param [in,out] dirtyNode flags DependencyNodes of DN to be called
+	/// \param [in] changes records the changes of the solve
+	/// \param [in,out] stats counts calls, passes and breakouts
+	/// \param [in] observer receives the DependencyGraphObserver events (may be NULL)
+	/// \return [bool] true if the worklist was emptied
+	///
+	/// - Each pass calls the dirty Connector TFs/FTs followed by the dirty Component TFTs in the
+	/// same order as a full sweep would\n
+	/// - A Connector that changes data marks the DependencyNode it writes to (To for TF, From for FT)\n
+	/// - A DependencyNode that changes data marks all Connectors of the View touching it\n
+	/// - Stops when the worklist is empty or after SmartDG_CIRCULAR_DEPENDENCY_BREAKOUT_COUNT passes
+	///
+	/// \see SolveTopological(string obj, int direction, vector<bool> &dirtyConnector, vector<bool> &dirtyNode, DependencyDataChanges &changes, DependencySolveStats &stats, DependencyGraphObserver *observer)
+	//////////////////////////////////////////////////
+	bool SolvePasses(string obj, int direction, vector<bool> &dirtyConnector,
+			vector<bool> &dirtyNode, DependencyDataChanges &changes,
+			DependencySolveStats &stats, DependencyGraphObserver *observer);
+	//////////////////////////////////////////////////
+	/// \fn bool SolveTopological(string obj, int direction, vector<bool> &dirtyConnector, vector<bool> &dirtyNode, DependencyDataChanges &changes, DependencySolveStats &stats, DependencyGraphObserver *observer)
+	/// \brief Propagates the worklist along SCC (strongly connected components)
+	/// \param [in] obj is DependencyObject name of the View
+	/// \param [in] direction is 1 for TF and -1 for FT
+	/// \param [in,out] dirtyConnector flags Connectors of View[obj] to be called
+	/// \param [in,out] dirtyNode flags DependencyNodes of DN to be called
+	/// \param [in] changes records the changes of the solve
+	/// \param [in,out] stats counts calls, passes and breakouts
+	/// \param [in] observer receives the DependencyGraphObserver events (may be NULL)
+	/// \return [bool] true if all cyclic components converged
+	///
+	/// - Visits components in topological order (reverse order for FT)\n
+	/// - Acyclic component: calls its dirty incoming Connectors and then its DependencyNode once\n
+	/// - Cyclic component: iterates its Connectors and DependencyNodes till no Connector inside
+	/// is dirty or SmartDG_CIRCULAR_DEPENDENCY_BREAKOUT_COUNT passes; a breakout reports the
+	/// component and solving continues downstream\n
+	/// - A DependencyNode that changes data marks the Connectors reading from it (From for TF, To for FT)
+	///
+	/// \see SolvePasses(string obj, int direction, vector<bool> &dirtyConnector, vector<bool> &dirtyNode, DependencyDataChanges &changes, DependencySolveStats &stats, DependencyGraphObserver *observer)
+	//////////////////////////////////////////////////
+	bool SolveTopological(string obj, int direction,
+			vector<bool> &dirtyConnector, vector<bool> &dirtyNode,
+			DependencyDataChanges &changes, DependencySolveStats &stats,
+			DependencyGraphObserver *observer);
+	//////////////////////////////////////////////////
+	/// \fn bool Solve(string obj, int direction, vector<bool> &dirtyConnector, vector<bool> &dirtyNode, DependencyDataBuffer &values, DependencyDataChanges &changes, DependencySolveStats &stats, DependencyGraphObserver *observer)
+	/// \brief Solves the View of a DependencyObject on the given buffer
+	/// \param [in] obj is DependencyObject name of the View
+	/// \param [in] direction is 1 for TF and -1 for FT
+	/// \param [in,out] dirtyConnector flags Connectors of View[obj] to be called
+	/// \param [in,out] dirtyNode flags DependencyNodes of DN to be called
+	/// \param [in,out] values is the DependencyDataBuffer solved (Values or a buffer of the same layout)
+	/// \param [out] changes records the changes made to values
+	/// \param [out] stats receives the performance counters
+	/// \param [in] observer receives the DependencyGraphObserver events (may be NULL)
+	/// \return [bool] true if the worklist was emptied (no circular dependency breakout)
+	///
+	/// - Resets changes and attaches it to values for the duration of the call\n
+	/// - Resets stats and fills it (calls, passes, breakouts, time per DependencyNode)\n
+	/// - Binds values to DependencyObject::bound on the calling thread for the duration of the call\n
+	/// - Calls SolveTopological() if SmartDG_TOPOLOGICAL_SOLVER is set and SCC is available for
+	/// the View, SolvePasses() otherwise
+	///
+	/// Does not call DependencyGraphObserver::Solved().
+	//////////////////////////////////////////////////
+	bool Solve(string obj, int direction, vector<bool> &dirtyConnector,
+			vector<bool> &dirtyNode, DependencyDataBuffer &values,
+			DependencyDataChanges &changes, DependencySolveStats &stats,
+			DependencyGraphObserver *observer);
 public:
 	string Name; ///< Name given to uniquely identify a DependencyGraph object
 	vector<DependencyNode> DN; ///< A vector of DependencyNode objects
 	//////////////////////////////////////////////////
-	/// \var ulm
-	/// \brief URL list map:\n
-	/// A 4 dimensional string map from
-	/// [DependencyNode Name]["In"/"Out"][DependencyPort Name][DependencyObject Name]
-	/// to corresponding URL.
-	//////////////////////////////////////////////////
-	map<string, map<string, map<string, map<string, URL> > > > ulm;
-	//////////////////////////////////////////////////
-	/// \var ulmi
-	/// \brief URL list map integer:\n
-	/// A 4 dimensional integer map from
-	/// [DependencyNode Index][0/1][DependencyPort Index][DependencyObject Index]
-	/// to corresponding URL.
+	/// \var ult
+	/// \brief URL list table:\n
+	/// A contiguous vector of URL objects for all DependencyObject objects in DN ordered by
+	/// [DependencyNode Index][0/1][DependencyPort Index][DependencyObject Index].
+	/// The position of a URL in ult is its dense URL id.
 	//////////////////////////////////////////////////
-	map<unsigned int,
-			map<unsigned int, map<unsigned int, map<unsigned int, URL> > > > ulmi;
+	vector<URL> ult;
+	vector<unsigned int> ultio; ///< Offsets into ultp for every [DependencyNode Index][0/1] pair at 2 * DependencyNode Index + 0/1 (plus one closing entry)
+	vector<unsigned int> ultp; ///< Offsets into ult for every DependencyPort in ultio order (plus one closing entry)
+	unordered_map<string, unsigned int> uli; ///< URL list index: A hash map from URL::str (<Node>.<In/Out>.<Port>.<Object>) to URL id in ult
 	vector<string> dobjs; ///< A vector of all unique DependencyObject objects in the DependencyGraph
 	map<string, vector<Dependency> > View; ///< A string map from [DependencyObject Name] to a vector of corresponding Dependency objects
 	DependencyObjectInstances DOI; ///< A DependencyObjectInstances object to encapsulate all dependency object instances
 	//////////////////////////////////////////////////
+	/// \var SCC
+	/// \brief Strongly connected components:\n
+	/// A string map from [DependencyObject Name] to the strongly connected components
+	/// (vectors of DependencyNode indexes in ascending order) of the graph formed by DN and
+	/// the Dependency objects in View[DependencyObject Name], in topological order (Source to Target).
+	//////////////////////////////////////////////////
+	map<string, vector<vector<unsigned int> > > SCC;
+	map<string, vector<unsigned int> > SCCIndex; ///< A string map from [DependencyObject Name] to the SCC index of every DependencyNode in DN
+	map<string, vector<bool> > SCCCyclic; ///< A string map from [DependencyObject Name] to a flag for every SCC entry which is true if the component contains a cycle
+	//////////////////////////////////////////////////
+	/// \var Values
+	/// \brief Values of all udi (Dependency Object's Unique Dependency Instances):\n
+	/// A DependencyDataBuffer holding two values per Dependency object, at Dependency::FromValue()
+	/// (Source udi) and Dependency::ToValue() (Target udi). DependencyObject::udb of every
+	/// DependencyObject in DN points to it.\n
+	/// Copies of a DependencyGraph get their own copy of the buffer; DependencyGraph objects
+	/// built from the same graph may share one buffer instead (see ShareValues()). Solve() may
+	/// also be handed another buffer of the same layout (e.g. a copy of Values).
+	//////////////////////////////////////////////////
+	shared_ptr<DependencyDataBuffer> Values;
+	DependencyDataChanges Changes; ///< Changes made to Values during the current (or last) call to Solve() without explicit state
+	DependencySolveStats Stats; ///< Performance counters of the current (or last) call to Solve() without explicit state
+	vector<unsigned int> SyncFrom; ///< URL id in SmartDG_GlobalData::GlobalPackage of DependencyObjectInstance::pou for every DOI.I entry (filled by DependencyMonitor::SyncKeys())
+	vector<unsigned int> SyncTo; ///< URL id in SmartDG_GlobalData::GlobalPackage of DependencyObjectInstance::tou for every DOI.I entry (filled by DependencyMonitor::SyncKeys())
+	unordered_map<uint64_t, unsigned int> SyncIndex; ///< A hash map from SmartDG_GlobalData::GlobalPackage key to DOI.I index (filled by DependencyMonitor::SyncKeys())
+	vector<string> LiteKeys; ///< DGlite element id of every DOI.I entry (filled by DependencyMonitor::SyncKeys())
+	vector<string> LiteAllKeys; ///< DGlite element id of the DependencyObject of every DOI.I entry (filled by DependencyMonitor::SyncKeys())
+	//////////////////////////////////////////////////
 	/// \fn DependencyGraph()
 	/// \brief Constructor
 	///
 	/// - Sets Default Name\n
+	/// - Creates Values
 	///
 	/// \see DependencyGraph(string GraphName)
 	//////////////////////////////////////////////////
@@ -66,22 +189,90 @@ public:
 	/// \brief Constructor
 	///
 	/// - Sets Name to GraphName\n
+	/// - Creates Values
 	///
 	/// \see DependencyGraph()
 	//////////////////////////////////////////////////
 	DependencyGraph(string GraphName);
 	//////////////////////////////////////////////////
+	/// \fn DependencyGraph(const DependencyGraph &from)
+	/// \brief Copy Constructor
+	///
+	/// - Copies all members (Values is copied, not shared)\n
+	/// - Calls BindValues()
+	///
+	/// \see operator=(const DependencyGraph &from)
+	//////////////////////////////////////////////////
+	DependencyGraph(const DependencyGraph &from);
+	//////////////////////////////////////////////////
+	/// \fn operator=(const DependencyGraph &from)
+	/// \brief Assignment operator
+	///
+	/// - Copies all members (Values is copied, not shared)\n
+	/// - Calls BindValues()
+	///
+	/// \see DependencyGraph(const DependencyGraph &from)
+	//////////////////////////////////////////////////
+	DependencyGraph& operator=(const DependencyGraph &from);
+	//////////////////////////////////////////////////
+	/// \fn void BindValues()
+	/// \brief Points DependencyObject::udb of every DependencyObject in DN to Values
+	//////////////////////////////////////////////////
+	void BindValues();
+	//////////////////////////////////////////////////
+	/// \fn void ShareValues(const DependencyGraph &from)
+	/// \brief Shares Values of another DependencyGraph with identical Dependency objects
+	/// \param [in] from is the DependencyGraph (e.g. the one this DependencyGraph was copied from)
+	///
+	/// - Points Values to from.Values and calls BindValues()\n
+	/// - Changes made by either DependencyGraph are seen by both without Sync; structure
+	/// (DN, View, ...) and GUI pointers stay separate
+	///
+	//////////////////////////////////////////////////
+	void ShareValues(const DependencyGraph &from);
+	//////////////////////////////////////////////////
+	/// \fn bool SharesValues()
+	/// \brief Returns true if Values is shared with another DependencyGraph
+	//////////////////////////////////////////////////
+	bool SharesValues();
+	//////////////////////////////////////////////////
 	/// \fn void Generate_URLs()
-	/// \brief Generates and fills URL objects for all DependencyObject objects in DN; Generates ulm and ulmi
+	/// \brief Generates and fills URL objects for all DependencyObject objects in DN; Generates ult and uli
 	///
 	/// - Sets URL objects for all DependencyObject objects in DependencyGraph\n
-	/// - Fills ulm (URL list map) for all DependencyObject URLs\n
-	/// - Fills ulmi (URL list map integer) for all DependencyObject URLs
+	/// - Fills ult (URL list table) and its offsets ultio and ultp for all DependencyObject URLs\n
+	/// - Fills uli (URL list index) for all DependencyObject URLs
 	///
 	/// \see Dependency()
 	//////////////////////////////////////////////////
 	void Generate_URLs();
 	//////////////////////////////////////////////////
+	/// \fn int URLId(string str)
+	/// \brief Resolves a URL string to its dense URL id in ult
+	/// \param [in] str is a URL string <Node>.<In/Out>.<Port>.<Object>
+	/// \return [int] URL id or -1 if str is not a URL of DependencyGraph
+	///
+	/// - Single hash lookup in uli (no entries are created for unknown strings)
+	///
+	/// \see URLId(unsigned int ni, unsigned int ioi, unsigned int pi, unsigned int oi)
+	//////////////////////////////////////////////////
+	int URLId(string str);
+	//////////////////////////////////////////////////
+	/// \fn int URLId(unsigned int ni, unsigned int ioi, unsigned int pi, unsigned int oi)
+	/// \brief Resolves URL indexes to the dense URL id in ult
+	///	\param [in] ni is NodeIndex
+	///	\param [in] ioi is InOutIndex
+	///	\param [in] pi is PortIndex
+	///	\param [in] oi is ObjectIndex
+	/// \return [int] URL id or -1 if any index is out of range
+	///
+	/// - Reads offsets ultio and ultp (no search)
+	///
+	/// \see URLId(string str)
+	//////////////////////////////////////////////////
+	int URLId(unsigned int ni, unsigned int ioi, unsigned int pi,
+			unsigned int oi);
+	//////////////////////////////////////////////////
 	/// \fn AddDependency(string name, string fni, string fpi, string foi, string tni, string tpi, string toi)
 	/// \brief Adds a Dependency object using connector name and individual indexes  (To and From) minus i/o index
 	/// \param [in] name 	is connector over which the dependency is established
@@ -92,13 +283,16 @@ public:
 	/// \param [in] tpi		is port index of target
 	/// \param [in] toi		is object index of target
 	///
+	/// \return [bool] false if the source or target URL does not exist (nothing is added)
+	///
+	/// - Resolves source and target URLs through uli (no entries are created for unknown names)\n
 	/// - Makes a Dependency object tmp\n
 	/// - Calls AddDependency(Dependency &tmp)
 	///
 	/// \see AddDependency(string name, DependencyNode fn, DependencyPort fp, DependencyObject ob, DependencyNode tn, DependencyPort tp)
 	/// \see AddDependency(Dependency &tmp)
 	//////////////////////////////////////////////////
-	void AddDependency(string name, string fni, string fpi, string foi,
+	bool AddDependency(string name, string fni, string fpi, string foi,
 			string tni, string tpi, string toi);
 	//////////////////////////////////////////////////
 	/// \fn AddDependency(string name, DependencyNode fn, DependencyPort fp, DependencyObject ob, DependencyNode tn, DependencyPort tp)
@@ -110,13 +304,14 @@ public:
 	/// \param [in] tn		is DependencyNode object of target
 	/// \param [in] tp		is DependencyPort object of target
 	///
-	/// - Makes a Dependency object tmp\n
-	/// - Calls AddDependency(Dependency &tmp)
+	/// \return [bool] false if the source or target URL does not exist (nothing is added)
+	///
+	/// - Calls AddDependency(string name, string fni, string fpi, string foi, string tni, string tpi, string toi)
 	///
 	/// \see AddDependency(string name, string fni, string fpi, string foi, string tni, string tpi, string toi)
 	/// \see AddDependency(Dependency &tmp)
 	//////////////////////////////////////////////////
-	void AddDependency(string name, DependencyNode fn, DependencyPort fp,
+	bool AddDependency(string name, DependencyNode fn, DependencyPort fp,
 			DependencyObject ob, DependencyNode tn, DependencyPort tp);
 	//////////////////////////////////////////////////
 	/// \fn AddDependency(Dependency &tmp)
@@ -124,8 +319,9 @@ public:
 	/// \param [in] tmp 	is a Dependency object
 	///
 	///	- Finds DependencyObject object's Name and sets obName to it\n
-	///	- Adds a new udi entry (Dependency Object's Unique Dependency Instance) in Source Node and sets its default value\n
-	///	- Adds a new udi entry (Dependency Object's Unique Dependency Instance) in Target Node and sets its default value\n
+	///	- Sets Dependency::id to the next dense dependency index\n
+	///	- Adds a new udi entry (Dependency Object's Unique Dependency Instance) in Source Node and sets its default value in Values\n
+	///	- Adds a new udi entry (Dependency Object's Unique Dependency Instance) in Target Node and sets its default value in Values\n
 	///	- Add DependencyObject object to dobjs if not already present in View\n
 	///	- Add the new Dependency object to DOI (DependencyObjectInstances object to encapsulate all dependency object instances)\n
 	///	- Add the new Dependency object to View (A string map from DependencyObject object's Name to a vector of corresponding Dependency objects)
@@ -135,14 +331,27 @@ public:
 	//////////////////////////////////////////////////
 	void AddDependency(Dependency &tmp);
 	//////////////////////////////////////////////////
+	/// \fn void Generate_SCC()
+	/// \brief Generates SCC, SCCIndex and SCCCyclic for all DependencyObject names in View
+	///
+	/// - Builds the graph formed by DN and View[DependencyObject Name] (Source to Target)\n
+	/// - Finds its strongly connected components (Tarjan) and stores them in topological order in SCC\n
+	/// - Fills SCCIndex and SCCCyclic (more than one DependencyNode or a Dependency from a DependencyNode to itself)
+	///
+	/// To be called once after the last call to AddDependency(Dependency &tmp)
+	///
+	/// \see AddDependency(Dependency &tmp)
+	/// \see Display_SCC()
+	//////////////////////////////////////////////////
+	void Generate_SCC();
+	//////////////////////////////////////////////////
 	/// \fn void Display()
 	/// \brief Display function for the complete DependencyGraph
 	///
 	/// - Calls DependencyNode::Display function for each DependencyNode in DN\n
 	///
 	/// \see Display_URLs()
-	/// \see Display_ulm()
-	/// \see Display_ulmi()
+	/// \see Display_ult()
 	/// \see DisplayDependency(string ob)
 	/// \see DisplayDependencyMini(string ob)
 	/// \see DisplayDependency()
@@ -157,8 +366,7 @@ public:
 	/// - Calls DependencyNode::Display_URLs function for each DependencyNode in DN\n
 	///
 	/// \see Display()
-	/// \see Display_ulm()
-	/// \see Display_ulmi()
+	/// \see Display_ult()
 	/// \see DisplayDependency(string ob)
 	/// \see DisplayDependencyMini(string ob)
 	/// \see DisplayDependency()
@@ -167,37 +375,20 @@ public:
 	//////////////////////////////////////////////////
 	void Display_URLs();
 	//////////////////////////////////////////////////
-	/// \fn void Display_ulm()
-	/// \brief Display function for ulm (URL list map) in DependencyGraph
+	/// \fn void Display_ult()
+	/// \brief Display function for ult (URL list table) in DependencyGraph
 	///
-	/// - Displays the complete ulm (URL list map)\n
+	/// - Displays the complete ult (URL list table) with URL ids\n
 	///
 	/// \see Display()
 	/// \see Display_URLs()
-	/// \see Display_ulmi()
 	/// \see DisplayDependency(string ob)
 	/// \see DisplayDependencyMini(string ob)
 	/// \see DisplayDependency()
 	/// \see DisplayDependencyValues(string ob)
 	/// \see DisplayDependencyValues()
 	//////////////////////////////////////////////////
-	void Display_ulm();
-	//////////////////////////////////////////////////
-	/// \fn void Display_ulmi()
-	/// \brief Display function for ulm (URL list map integer) in DependencyGraph
-	///
-	/// - Displays the complete ulmi (URL list map integer)\n
-	///
-	/// \see Display()
-	/// \see Display_URLs()
-	/// \see Display_ulm()
-	/// \see DisplayDependency(string ob)
-	/// \see DisplayDependencyMini(string ob)
-	/// \see DisplayDependency()
-	/// \see DisplayDependencyValues(string ob)
-	/// \see DisplayDependencyValues()
-	//////////////////////////////////////////////////
-	void Display_ulmi();
+	void Display_ult();
 	//////////////////////////////////////////////////
 	/// \fn void DisplayDependency(string ob)
 	/// \brief Display function for all Dependency objects corresponding to DependencyObject ob in DependencyGraph
@@ -206,8 +397,7 @@ public:
 	///
 	/// \see Display()
 	/// \see Display_URLs()
-	/// \see Display_ulm()
-	/// \see Display_ulmi()
+	/// \see Display_ult()
 	/// \see DisplayDependencyMini(string ob)
 	/// \see DisplayDependency()
 	/// \see DisplayDependencyValues(string ob)
@@ -222,8 +412,7 @@ public:
 	///
 	/// \see Display()
 	/// \see Display_URLs()
-	/// \see Display_ulm()
-	/// \see Display_ulmi()
+	/// \see Display_ult()
 	/// \see DisplayDependency(string ob)
 	/// \see DisplayDependency()
 	/// \see DisplayDependencyValues(string ob)
@@ -238,8 +427,7 @@ public:
 	///
 	/// \see Display()
 	/// \see Display_URLs()
-	/// \see Display_ulm()
-	/// \see Display_ulmi()
+	/// \see Display_ult()
 	/// \see DisplayDependency(string ob)
 	/// \see DisplayDependencyMini(string ob)
 	/// \see DisplayDependencyValues(string ob)
@@ -254,8 +442,7 @@ public:
 	///
 	/// \see Display()
 	/// \see Display_URLs()
-	/// \see Display_ulm()
-	/// \see Display_ulmi()
+	/// \see Display_ult()
 	/// \see DisplayDependency(string ob)
 	/// \see DisplayDependencyMini(string ob)
 	/// \see DisplayDependency()
@@ -270,8 +457,7 @@ public:
 	///
 	/// \see Display()
 	/// \see Display_URLs()
-	/// \see Display_ulm()
-	/// \see Display_ulmi()
+	/// \see Display_ult()
 	/// \see DisplayDependency(string ob)
 	/// \see DisplayDependencyMini(string ob)
 	/// \see DisplayDependency()
@@ -279,6 +465,73 @@ public:
 	//////////////////////////////////////////////////
 	void DisplayDependencyValues();
 	//////////////////////////////////////////////////
+	/// \fn void Display_SCC()
+	/// \brief Display function for SCC (strongly connected components) in DependencyGraph
+	///
+	/// - Displays SCC of all DependencyObject names in View in topological order; cyclic components are marked with *\n
+	///
+	/// \see Generate_SCC()
+	//////////////////////////////////////////////////
+	void Display_SCC();
+	//////////////////////////////////////////////////
+	/// \fn string SCCStr(string ob, unsigned int s)
+	/// \brief Returns names of all DependencyNode objects in a strongly connected component
+	/// \param [in] ob is DependencyObject name of the View
+	/// \param [in] s is index of the component in SCC[ob]
+	/// \return [string] "SCC s {Node, Node, ...}"
+	//////////////////////////////////////////////////
+	string SCCStr(string ob, unsigned int s);
+	//////////////////////////////////////////////////
+	/// \fn bool Solve(string obj, int direction = 1, DependencyGraphObserver *observer = NULL)
+	/// \brief Solves the View of a DependencyObject from scratch
+	/// \param [in] obj is DependencyObject name of the View
+	/// \param [in] direction is 1 for transfer functions (TF) and -1 for inverse transfer functions (FT)
+	/// \param [in] observer receives the DependencyGraphObserver events (NULL : headless)
+	/// \return [bool] true if the View converged
+	///
+	/// - Seeds every Connector of View[obj] and every DependencyNode\n
+	/// - Calls Solve(string obj, int direction, vector<bool> &dirtyConnector, vector<bool> &dirtyNode, DependencyGraphObserver *observer)
+	///
+	//////////////////////////////////////////////////
+	bool Solve(string obj, int direction = 1, DependencyGraphObserver *observer =
+			NULL);
+	//////////////////////////////////////////////////
+	/// \fn bool Solve(string obj, int direction, vector<bool> &dirtyConnector, vector<bool> &dirtyNode, DependencyGraphObserver *observer = NULL)
+	/// \brief Solves the View of a DependencyObject by propagating a worklist of dirty Connectors and DependencyNodes
+	/// \param [in] obj is DependencyObject name of the View
+	/// \param [in] direction is 1 for transfer functions (TF) and -1 for inverse transfer functions (FT)
+	/// \param [in,out] dirtyConnector flags Connectors of View[obj] to be called (size View[obj].size())
+	/// \param [in,out] dirtyNode flags DependencyNodes of DN to be called (size DN.size())
+	/// \param [in] observer receives the DependencyGraphObserver events (NULL : headless)
+	/// \return [bool] true if the worklist was emptied (no circular dependency breakout)
+	///
+	/// - Solves on Values, recording into Changes and Stats (see the private Solve() with explicit state)\n
+	/// - Calls DependencyGraphObserver::Solved() at the end
+	///
+	/// No FLTK object is touched: Connectors only record their Dependency::direction, which the
+	/// observer may apply to the GUI afterwards. Skipping clean entries yields the same values as
+	/// a full sweep as long as the transfer functions depend only on the data they are handed.
+	//////////////////////////////////////////////////
+	bool Solve(string obj, int direction, vector<bool> &dirtyConnector,
+			vector<bool> &dirtyNode, DependencyGraphObserver *observer = NULL);
+	//////////////////////////////////////////////////
+	/// \fn bool Solve(string obj, int direction, DependencyDataBuffer &values, DependencyDataChanges &changes, DependencySolveStats &stats)
+	/// \brief Solves the View of a DependencyObject from scratch on a buffer of its own (headless)
+	/// \param [in] obj is DependencyObject name of the View
+	/// \param [in] direction is 1 for transfer functions (TF) and -1 for inverse transfer functions (FT)
+	/// \param [in,out] values is a DependencyDataBuffer with the layout of Values (e.g. a copy of it)
+	/// \param [out] changes records the changes made to values
+	/// \param [out] stats receives the performance counters
+	/// \return [bool] true if the View converged
+	///
+	/// - Seeds every Connector of View[obj] and every DependencyNode\n
+	/// - Leaves Values, Changes and Stats untouched, so that Views of different DependencyObject
+	/// objects may be solved concurrently on one DependencyGraph (each with its own buffer)
+	///
+	//////////////////////////////////////////////////
+	bool Solve(string obj, int direction, DependencyDataBuffer &values,
+			DependencyDataChanges &changes, DependencySolveStats &stats);
+	//////////////////////////////////////////////////
 	/// \fn ~DependencyGraph()
 	/// \brief Default Destructor
 	//////////////////////////////////////////////////
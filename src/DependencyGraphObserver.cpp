@@ -0,0 +1,35 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyGraphObserver.cpp
+/// \brief	Source file for DependencyGraphObserver class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+
+void DependencyGraphObserver::SolvedConnector(Dependency &d, int direction,
+		bool changed) {
+}
+
+void DependencyGraphObserver::SolvedNode(DependencyNode &n, int direction,
+		bool changed) {
+}
+
+void DependencyGraphObserver::Solved(DependencyGraph &DG, string obj,
+		int direction, bool converged) {
+}
+
+DependencyGraphObserver::~DependencyGraphObserver() {
+}
+
+} /* namespace SmartDG */
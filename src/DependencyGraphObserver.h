@@ -0,0 +1,70 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyGraphObserver.h
+/// \brief	Header file for DependencyGraphObserver class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DEPENDENCYGRAPHOBSERVER_H_
+#define DEPENDENCYGRAPHOBSERVER_H_
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+class DependencyGraph;
+////////////////////////////////////////////////////////////////////////////////
+///	\class DependencyGraphObserver
+/// \brief DependencyGraphObserver class receives the events of DependencyGraph::Solve()
+///
+/// DependencyGraph::Solve() touches no GUI object. A front end (e.g. DependencyMonitor) that
+/// wants to trace a solve or refresh its graphics derives from this class and passes itself to
+/// DependencyGraph::Solve(); headless callers pass NULL. All functions do nothing by default.
+////////////////////////////////////////////////////////////////////////////////
+class DependencyGraphObserver {
+public:
+	//////////////////////////////////////////////////
+	/// \fn void SolvedConnector(Dependency &d, int direction, bool changed)
+	/// \brief Called after the TF (direction 1) or FT (direction -1) of a Connector was called
+	/// \param [in] d is the Connector
+	/// \param [in] direction is 1 for TF and -1 for FT
+	/// \param [in] changed is true if any value was changed
+	//////////////////////////////////////////////////
+	virtual void SolvedConnector(Dependency &d, int direction, bool changed);
+	//////////////////////////////////////////////////
+	/// \fn void SolvedNode(DependencyNode &n, int direction, bool changed)
+	/// \brief Called after TFT.CallTF() (direction 1) or TFT.CallFT() (direction -1) of a DependencyNode was called
+	/// \param [in] n is the DependencyNode
+	/// \param [in] direction is 1 for TF and -1 for FT
+	/// \param [in] changed is true if any value was changed
+	//////////////////////////////////////////////////
+	virtual void SolvedNode(DependencyNode &n, int direction, bool changed);
+	//////////////////////////////////////////////////
+	/// \fn void Solved(DependencyGraph &DG, string obj, int direction, bool converged)
+	/// \brief Called once at the end of DependencyGraph::Solve()
+	/// \param [in] DG is the solved DependencyGraph (DG.Changes holds the changes of the solve)
+	/// \param [in] obj is DependencyObject name of the View
+	/// \param [in] direction is 1 for TF and -1 for FT
+	/// \param [in] converged is the return value of DependencyGraph::Solve()
+	///
+	/// - GUI updates (e.g. GUIConnection::setDirection() from Dependency::direction) belong here
+	//////////////////////////////////////////////////
+	virtual void Solved(DependencyGraph &DG, string obj, int direction,
+			bool converged);
+	//////////////////////////////////////////////////
+	/// \fn ~DependencyGraphObserver()
+	/// \brief Default Destructor
+	//////////////////////////////////////////////////
+	virtual ~DependencyGraphObserver();
+};
+
+} /* namespace SmartDG */
+
+#endif /* DEPENDENCYGRAPHOBSERVER_H_ */
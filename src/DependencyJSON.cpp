@@ -0,0 +1,36 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyJSON.cpp
+/// \brief	Source file for DependencyJSON class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+
+string DependencyJSON::Escape(const string &text) {
+	ostringstream out;
+	for (unsigned int i = 0; i < text.size(); i++) {
+		unsigned char c = text[i];
+		if ((c == '"') || (c == '\\'))
+			out << '\\' << c;
+		else if (c < 0x20)
+			// Control characters as \u00XX
+			out << "\\u00" << hex << setw(2) << setfill('0') << (unsigned int) c
+					<< dec;
+		else
+			out << c;
+	}
+	return out.str();
+}
+
+} /* namespace SmartDG */
@@ -0,0 +1,39 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyJSON.h
+/// \brief	Header file for DependencyJSON class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DEPENDENCYJSON_H_
+#define DEPENDENCYJSON_H_
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+////////////////////////////////////////////////////////////////////////////////
+///	\class DependencyJSON
+/// \brief DependencyJSON class holds the helpers shared by all JSON writers
+///
+/// Used by DependencySolveStats::JSON() and DependencyLiteServer::Delta().
+////////////////////////////////////////////////////////////////////////////////
+class DependencyJSON {
+public:
+	//////////////////////////////////////////////////
+	/// \fn static string Escape(const string &text)
+	/// \brief Returns text escaped for a JSON string (quote, backslash and control characters)
+	//////////////////////////////////////////////////
+	static string Escape(const string &text);
+};
+
+} /* namespace SmartDG */
+
+#endif /* DEPENDENCYJSON_H_ */
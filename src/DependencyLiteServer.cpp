@@ -0,0 +1,261 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyLiteServer.cpp
+/// \brief	Source file for DependencyLiteServer class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SmartDG.h"
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace SmartDG {
+
+bool DependencyLiteServer::Start(string directory, unsigned short port) {
+	if (started)
+		return true;
+	int listener = socket(AF_INET, SOCK_STREAM, 0);
+	int on = 1;
+	if (listener >= 0)
+		setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+	// localhost only
+	sockaddr_in address;
+	memset(&address, 0, sizeof(address));
+	address.sin_family = AF_INET;
+	address.sin_port = htons(port);
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	if ((listener < 0)
+			|| (bind(listener, (sockaddr*) &address, sizeof(address)) < 0)
+			|| (listen(listener, SOMAXCONN) < 0)) {
+		cout << "ERROR[DGLITE SERVER NOT STARTED]: localhost:" << port << " : "
+				<< strerror(errno) << endl;
+		if (listener >= 0)
+			close(listener);
+		return false;
+	}
+	// Stop() wakes the I/O thread through a pipe
+	if (pipe(wakeup) < 0) {
+		cout << "ERROR[DGLITE SERVER NOT STARTED]: localhost:" << port << " : "
+				<< strerror(errno) << endl;
+		close(listener);
+		return false;
+	}
+	fcntl(listener, F_SETFL, fcntl(listener, F_GETFL, 0) | O_NONBLOCK);
+	root = directory;
+	generation = chrono::duration_cast<chrono::milliseconds>(
+			chrono::system_clock::now().time_since_epoch()).count();
+	started = true;
+	worker = new thread(Run, listener);
+	if (SmartDG_SyncLiteVerbose)
+		cout << "DependencyLiteServer: http://localhost:" << port << "/"
+				<< SmartDG_BaseLite << ".html" << endl;
+	return true;
+}
+
+void DependencyLiteServer::Stop() {
+	if (!started)
+		return;
+	// Wakes the I/O thread, which closes all sockets and returns
+	char c = 0;
+	while ((write(wakeup[1], &c, 1) < 0) && (errno == EINTR))
+		;
+	worker->join();
+	delete worker;
+	worker = NULL;
+	close(wakeup[0]);
+	close(wakeup[1]);
+	started = false;
+}
+
+void DependencyLiteServer::Run(int listener) {
+	// fds[0] is the listener, fds[1] the wakeup pipe, fds[c] (c > 1) are connections
+	// with request read so far in[c] and response left to send out[c] from sent[c]
+	vector<pollfd> fds(2);
+	fds[0].fd = listener;
+	fds[0].events = POLLIN;
+	fds[1].fd = wakeup[0];
+	fds[1].events = POLLIN;
+	vector<string> in(2), out(2);
+	vector<size_t> sent(2, 0);
+	char buffer[4096];
+	while (true) {
+		if (poll(&fds[0], fds.size(), -1) < 0) {
+			if (errno == EINTR)
+				continue;
+			cout << "ERROR[DGLITE SERVER STOPPED]: " << strerror(errno) << endl;
+			break;
+		}
+		// Stop()
+		if (fds[1].revents & POLLIN)
+			break;
+		// Accepts all pending connections
+		if (fds[0].revents & POLLIN) {
+			int fd;
+			while ((fd = accept(listener, NULL, NULL)) >= 0) {
+				fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+				pollfd p;
+				p.fd = fd;
+				p.events = POLLIN;
+				p.revents = 0;
+				fds.push_back(p);
+				in.push_back("");
+				out.push_back("");
+				sent.push_back(0);
+			}
+		}
+		// Backwards, so that closed connections can be erased
+		for (unsigned int c = fds.size() - 1; c > 1; c--) {
+			bool done = false;
+			if (fds[c].revents & POLLIN) {
+				ssize_t n;
+				while ((n = recv(fds[c].fd, buffer, sizeof(buffer), 0)) > 0)
+					in[c].append(buffer, n);
+				if (in[c].find("\r\n\r\n") != string::npos) {
+					// Complete request, responds (one request per connection)
+					out[c] = Respond(in[c]);
+					fds[c].events = POLLOUT;
+				} else if ((n == 0)
+						|| ((n < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK))
+						|| (in[c].size() > SmartDG_LITE_REQUEST_LIMIT))
+					done = true;
+			} else if (fds[c].revents & POLLOUT) {
+				ssize_t n = send(fds[c].fd, out[c].data() + sent[c],
+						out[c].size() - sent[c], MSG_NOSIGNAL);
+				if (n > 0)
+					sent[c] += n;
+				if ((sent[c] == out[c].size())
+						|| ((n < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK)))
+					done = true;
+			} else if (fds[c].revents & (POLLERR | POLLHUP | POLLNVAL))
+				done = true;
+			if (done) {
+				close(fds[c].fd);
+				fds.erase(fds.begin() + c);
+				in.erase(in.begin() + c);
+				out.erase(out.begin() + c);
+				sent.erase(sent.begin() + c);
+			}
+		}
+	}
+	// Closes the listener and all connections
+	close(listener);
+	for (unsigned int c = 2; c < fds.size(); c++)
+		close(fds[c].fd);
+}
+
+string DependencyLiteServer::Respond(string request) {
+	// Request line : method target version
+	istringstream line(request.substr(0, request.find("\r\n")));
+	string method, target;
+	line >> method >> target;
+	size_t q = target.find('?');
+	string path = target.substr(0, q);
+	string query = (q == string::npos) ? "" : target.substr(q + 1);
+	if (SmartDG_SyncLiteVerbose)
+		cout << "DependencyLiteServer: " << method << " " << target << endl;
+
+	string status = "200 OK";
+	string type = "text/plain";
+	string body;
+	string js = string(SmartDG_LITE_JS_PATH) + "/";
+	if ((method != "GET") && (method != "HEAD"))
+		status = "405 Method Not Allowed";
+	else if (path == "/" + string(SmartDG_BaseLite) + ".delta") {
+		type = "application/json";
+		body = Delta(query);
+	} else {
+		if (path == "/")
+			path = "/" + string(SmartDG_BaseLite) + ".html";
+		// Installed JavaScript libraries by absolute path, everything else from the DGlite directory
+		string file = (path.compare(0, js.size(), js) == 0) ? path : root + path;
+		ifstream f;
+		if (path.find("..") == string::npos)
+			f.open(file, ios::binary);
+		if (!f.is_open())
+			status = "404 Not Found";
+		else {
+			stringstream content;
+			content << f.rdbuf();
+			body = content.str();
+			string ext = path.substr(path.find_last_of('.') + 1);
+			if (ext == "html")
+				type = "text/html";
+			else if (ext == "js")
+				type = "application/javascript";
+			else if (ext == "css")
+				type = "text/css";
+			else if (ext == "json")
+				type = "application/json";
+		}
+	}
+
+	ostringstream response;
+	response << "HTTP/1.1 " << status << "\r\n";
+	response << "Content-Type: " << type << "\r\n";
+	response << "Content-Length: " << body.size() << "\r\n";
+	response << "Cache-Control: no-cache\r\n";
+	response << "Connection: close\r\n\r\n";
+	if (method != "HEAD")
+		response << body;
+	return response.str();
+}
+
+string DependencyLiteServer::Delta(string query) {
+	// Generation and version last returned to the browser
+	unsigned long g = 0, v = 0;
+	istringstream fields(query);
+	string field;
+	while (getline(fields, field, '&'))
+		if (field.compare(0, 2, "g=") == 0)
+			g = strtoul(field.c_str() + 2, NULL, 10);
+		else if (field.compare(0, 2, "v=") == 0)
+			v = strtoul(field.c_str() + 2, NULL, 10);
+	if (g != generation)
+		v = 0;
+	vector<std::pair<string, string>> delta;
+	unsigned long latest = v;
+	// Skips the snapshot scan when nothing was published since v
+	if ((v == 0) || (v < SmartDG_GlobalData::GlobalPackageLite.Version()))
+		latest = DependencyLiteSnapshot::Delta(
+				*SmartDG_GlobalData::GlobalPackageLite.Snapshot(), v, delta);
+	// Blinks once every 11 SmartDG_SLEEP_BETWEEN_SYNLITE periods (togglelive is atomic, written from this thread)
+	int blink = (chrono::duration_cast<chrono::milliseconds>(
+			chrono::steady_clock::now().time_since_epoch()).count()
+			/ SmartDG_SLEEP_BETWEEN_SYNLITE) % 11;
+	SmartDG_GlobalData::togglelive = blink;
+
+	ostringstream json;
+	json << "{\"g\":" << generation << ",\"v\":" << latest << ",\"d\":[";
+	json << "{\"id\":\"" << "#BLINKY" << "\",\"val\":\"" << to_string(blink)
+			<< "\"}";
+	for (unsigned int i = 0; i < delta.size(); i++)
+		json << ",{\"id\":\"" << DependencyJSON::Escape(delta[i].first)
+				<< "\",\"val\":\"" << DependencyJSON::Escape(delta[i].second)
+				<< "\"}";
+	json << "]}";
+	return json.str();
+}
+
+// true once Start() succeeded
+bool DependencyLiteServer::started = false;
+// DGlite directory served
+string DependencyLiteServer::root;
+// Server instance id
+unsigned long DependencyLiteServer::generation = 0;
+// I/O thread, joined by Stop() (left running at exit without Stop())
+thread *DependencyLiteServer::worker = NULL;
+// Pipe Stop() wakes the I/O thread through
+int DependencyLiteServer::wakeup[2] = { -1, -1 };
+
+} /* namespace SmartDG */
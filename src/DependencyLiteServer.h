@@ -0,0 +1,88 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyLiteServer.h
+/// \brief	Header file for DependencyLiteServer class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DEPENDENCYLITESERVER_H_
+#define DEPENDENCYLITESERVER_H_
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+////////////////////////////////////////////////////////////////////////////////
+///	\class DependencyLiteServer
+/// \brief DependencyLiteServer class is the embedded HTTP server of DGlite ( Web Browser View )
+///
+/// Serves on localhost (SmartDG_LITE_SERVER_PORT), from a dedicated I/O thread:\n
+/// - the generated DGlite files (html, js, css) of the DGlite directory\n
+/// - the JavaScript libraries installed in SmartDG_LITE_JS_PATH\n
+/// - SmartDG_BaseLite.delta : the SmartDG_GlobalData::GlobalPackageLite entries changed since the
+/// version seen by the browser, straight from the published DependencyLiteSnapshot
+///
+/// The I/O thread multiplexes all connections with poll() on non-blocking sockets and only
+/// reads published snapshots, so it never blocks the FLTK loop and the FLTK loop never blocks it.
+/// All members are static: there is one server per process.
+////////////////////////////////////////////////////////////////////////////////
+class DependencyLiteServer {
+private:
+	static bool started; ///< true once Start() succeeded
+	static string root; ///< DGlite directory served
+	static unsigned long generation; ///< Server instance id, a browser seeing a new one asks for all entries
+	static thread *worker; ///< I/O thread, joined by Stop() (left running at exit without Stop())
+	static int wakeup[2]; ///< Pipe Stop() wakes the I/O thread through
+	//////////////////////////////////////////////////
+	/// \fn static void Run(int listener)
+	/// \brief I/O thread: accepts connections, reads requests and writes responses until exit
+	/// \param [in] listener is the non-blocking listening socket
+	//////////////////////////////////////////////////
+	static void Run(int listener);
+public:
+	//////////////////////////////////////////////////
+	/// \fn static bool Start(string directory, unsigned short port = SmartDG_LITE_SERVER_PORT)
+	/// \brief Starts the server thread, does nothing if already started
+	/// \param [in] directory is the DGlite directory to serve
+	/// \param [in] port is the localhost port to listen on
+	/// \return [bool] true if the server is running
+	//////////////////////////////////////////////////
+	static bool Start(string directory, unsigned short port =
+	SmartDG_LITE_SERVER_PORT);
+	//////////////////////////////////////////////////
+	/// \fn static void Stop()
+	/// \brief Stops the server thread and closes its sockets, does nothing if not started
+	//////////////////////////////////////////////////
+	static void Stop();
+	//////////////////////////////////////////////////
+	/// \fn static string Respond(string request)
+	/// \brief Returns the complete HTTP response to a complete HTTP request
+	/// \param [in] request is the request line and headers
+	///
+	/// - GET and HEAD only, anything else is answered with 405\n
+	/// - Paths containing ".." are answered with 404
+	///
+	//////////////////////////////////////////////////
+	static string Respond(string request);
+	//////////////////////////////////////////////////
+	/// \fn static string Delta(string query)
+	/// \brief Returns the JSON body of SmartDG_BaseLite.delta
+	/// \param [in] query is "g=<generation>&v=<version>" as last returned to the browser
+	///
+	/// - {"g":generation,"v":version,"d":[{"id":..,"val":..},..]}\n
+	/// - All entries if g is not the server generation, else only the entries changed after v
+	///
+	//////////////////////////////////////////////////
+	static string Delta(string query);
+};
+
+} /* namespace SmartDG */
+
+#endif /* DEPENDENCYLITESERVER_H_ */
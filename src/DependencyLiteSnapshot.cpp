@@ -0,0 +1,78 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyLiteSnapshot.cpp
+/// \brief	Source file for DependencyLiteSnapshot class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+
+DependencyLiteSnapshot::DependencyLiteSnapshot() {
+	// Readers always get a valid (possibly empty) snapshot
+	published = make_shared<const Entries>();
+	version = 0;
+	dirty = false;
+}
+
+void DependencyLiteSnapshot::Set(string id, string value) {
+	Entries::iterator it = working.find(id);
+	if (it != working.end() && it->second.first == value)
+		return;
+	// Stamped with the version of the next Publish()
+	working[id] = make_pair(value, version + 1);
+	dirty = true;
+}
+
+string DependencyLiteSnapshot::Get(string id) {
+	Entries::const_iterator it = working.find(id);
+	if (it == working.end())
+		return "";
+	return it->second.first;
+}
+
+void DependencyLiteSnapshot::Publish() {
+	if (!dirty)
+		return;
+	// Readers holding the old copy keep iterating it, it is freed with its last reader
+	shared_ptr<const Entries> copy = make_shared<const Entries>(working);
+	atomic_store(&published, copy);
+	// Bumped after the store: a reader seeing the new version finds the new snapshot
+	version++;
+	dirty = false;
+}
+
+shared_ptr<const DependencyLiteSnapshot::Entries> DependencyLiteSnapshot::Snapshot() const {
+	return atomic_load(&published);
+}
+
+unsigned long DependencyLiteSnapshot::Version() const {
+	return version;
+}
+
+unsigned long DependencyLiteSnapshot::Delta(const Entries &snapshot,
+		unsigned long since, vector<pair<string, string>> &delta) {
+	delta.clear();
+	unsigned long latest = since;
+	for (Entries::const_iterator it = snapshot.begin(); it != snapshot.end();
+			++it)
+		if (it->second.second > since) {
+			delta.push_back(make_pair(it->first, it->second.first));
+			latest = max(latest, it->second.second);
+		}
+	return latest;
+}
+
+DependencyLiteSnapshot::~DependencyLiteSnapshot() {
+}
+
+} /* namespace SmartDG */
@@ -0,0 +1,107 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyLiteSnapshot.h
+/// \brief	Header file for DependencyLiteSnapshot class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DEPENDENCYLITESNAPSHOT_H_
+#define DEPENDENCYLITESNAPSHOT_H_
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+////////////////////////////////////////////////////////////////////////////////
+///	\class DependencyLiteSnapshot
+/// \brief DependencyLiteSnapshot class holds the DGlite entries (id -> value) shared with the DGlite server thread
+///
+/// The GUI thread is the only writer: it edits a private working map with Set() and makes the
+/// edits visible with Publish(), which swaps in an immutable copy of the working map.
+/// Reader threads take the current copy with Snapshot() and iterate it while the GUI thread
+/// goes on editing; a copy is freed when its last reader drops it.\n
+/// Snapshot() and Publish() only swap a shared_ptr (std::atomic_load / std::atomic_store),
+/// so neither side ever waits for the other to finish iterating or editing.\n
+/// Every Publish() that changes an entry bumps DependencyLiteSnapshot::version and every entry
+/// carries the version it last changed in, so that readers can stream only the entries changed
+/// since the version they saw last (Delta()).
+////////////////////////////////////////////////////////////////////////////////
+class DependencyLiteSnapshot {
+public:
+	typedef map<string, pair<string, unsigned long>> Entries; ///< id -> (value, version of last change)
+private:
+	Entries working; ///< Entries edited by the GUI thread
+	shared_ptr<const Entries> published; ///< Immutable copy of working last published
+	atomic<unsigned long> version; ///< Version of the last Publish() that changed an entry
+	bool dirty; ///< true if working changed since the last Publish()
+public:
+	//////////////////////////////////////////////////
+	/// \fn DependencyLiteSnapshot()
+	/// \brief Constructor, publishes an empty snapshot at version 0
+	//////////////////////////////////////////////////
+	DependencyLiteSnapshot();
+	//////////////////////////////////////////////////
+	/// \fn void Set(string id, string value)
+	/// \brief Sets an entry of the working map (GUI thread only)
+	/// \param [in] id is the DGlite element id
+	/// \param [in] value is the DGlite element value
+	///
+	/// - Not visible to readers until Publish()\n
+	/// - Does nothing if the entry already has value
+	///
+	//////////////////////////////////////////////////
+	void Set(string id, string value);
+	//////////////////////////////////////////////////
+	/// \fn string Get(string id)
+	/// \brief Returns an entry of the working map (GUI thread only), "" if not found
+	//////////////////////////////////////////////////
+	string Get(string id);
+	//////////////////////////////////////////////////
+	/// \fn void Publish()
+	/// \brief Makes all Set() entries visible to readers (GUI thread only)
+	///
+	/// - Does nothing if working is unchanged since the last Publish()
+	///
+	//////////////////////////////////////////////////
+	void Publish();
+	//////////////////////////////////////////////////
+	/// \fn shared_ptr<const Entries> Snapshot() const
+	/// \brief Returns the last published entries (any thread)
+	/// \return [shared_ptr<const Entries>] consistent snapshot, never NULL
+	//////////////////////////////////////////////////
+	shared_ptr<const Entries> Snapshot() const;
+	//////////////////////////////////////////////////
+	/// \fn unsigned long Version() const
+	/// \brief Returns the version of the last Publish() (any thread)
+	///
+	/// - A later Snapshot() is at least this version, so a reader that saw this version can skip Delta()
+	///
+	//////////////////////////////////////////////////
+	unsigned long Version() const;
+	//////////////////////////////////////////////////
+	/// \fn static unsigned long Delta(const Entries &snapshot, unsigned long since, vector<pair<string, string>> &delta)
+	/// \brief Returns the entries of a snapshot changed after a version
+	/// \param [in] snapshot is a snapshot returned by Snapshot()
+	/// \param [in] since is the version already seen by the reader, 0 for all entries
+	/// \param [out] delta are the (id, value) changed after since
+	/// \return [unsigned long] version of snapshot (since if nothing changed)
+	//////////////////////////////////////////////////
+	static unsigned long Delta(const Entries &snapshot, unsigned long since,
+			vector<pair<string, string>> &delta);
+	//////////////////////////////////////////////////
+	/// \fn ~DependencyLiteSnapshot()
+	/// \brief Default Destructor
+	//////////////////////////////////////////////////
+	virtual ~DependencyLiteSnapshot();
+};
+
+} /* namespace SmartDG */
+
+#endif /* DEPENDENCYLITESNAPSHOT_H_ */
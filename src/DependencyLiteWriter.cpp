@@ -0,0 +1,79 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyLiteWriter.cpp
+/// \brief	Source file for DependencyLiteWriter class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SmartDG.h"
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace SmartDG {
+
+bool DependencyLiteWriter::MakeDirectory(string path) {
+	// Every prefix ending before a '/' and the path itself, parents first
+	for (size_t i = 1; i <= path.size(); i++)
+		if ((i == path.size()) || (path[i] == '/')) {
+			string dir = path.substr(0, i);
+			if ((mkdir(dir.c_str(), 0755) != 0) && (errno != EEXIST)) {
+				cout << "ERROR[DIRECTORY NOT CREATED]: " << dir << " : "
+						<< strerror(errno) << endl;
+				return false;
+			}
+		}
+	return true;
+}
+
+bool DependencyLiteWriter::Write(string file, string content) {
+	string temp = file + ".tmp";
+	int error = 0;
+	int fd = open(temp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		error = errno;
+	// Whole content, write() may write less than asked
+	size_t done = 0;
+	while ((error == 0) && (done < content.size())) {
+		errno = 0;
+		ssize_t n = write(fd, content.data() + done, content.size() - done);
+		if (n > 0)
+			done += n;
+		else if (n == 0)
+			// Nothing written and no errno, retrying would spin
+			error = EIO;
+		else if (errno != EINTR)
+			error = (errno != 0) ? errno : EIO;
+	}
+	if ((error == 0) && (fsync(fd) != 0))
+		error = errno;
+	if ((fd >= 0) && (close(fd) != 0) && (error == 0))
+		error = errno;
+	if ((error == 0) && (rename(temp.c_str(), file.c_str()) != 0))
+		error = errno;
+	if (error != 0) {
+		cout << "ERROR[FILE NOT WRITTEN]: " << file << " : " << strerror(error)
+				<< endl;
+		unlink(temp.c_str());
+		return false;
+	}
+	// Makes the rename itself durable
+	size_t slash = file.find_last_of('/');
+	string dir = (slash == string::npos) ? "." : file.substr(0, slash + 1);
+	int dirfd = open(dir.c_str(), O_RDONLY);
+	if (dirfd >= 0) {
+		fsync(dirfd);
+		close(dirfd);
+	}
+	return true;
+}
+
+} /* namespace SmartDG */
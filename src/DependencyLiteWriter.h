@@ -0,0 +1,54 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyLiteWriter.h
+/// \brief	Header file for DependencyLiteWriter class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DEPENDENCYLITEWRITER_H_
+#define DEPENDENCYLITEWRITER_H_
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+////////////////////////////////////////////////////////////////////////////////
+///	\class DependencyLiteWriter
+/// \brief DependencyLiteWriter class writes the DGlite directory without subprocesses
+///
+/// Files are written to a temporary file next to the target, flushed to disk and renamed over
+/// the target, so DependencyLiteServer (or a browser) reads either the old or the new file,
+/// never a partly written one, even if the process dies while writing.
+////////////////////////////////////////////////////////////////////////////////
+class DependencyLiteWriter {
+public:
+	//////////////////////////////////////////////////
+	/// \fn static bool MakeDirectory(string path)
+	/// \brief Creates a directory and all its missing parents (as mkdir -p)
+	/// \param [in] path is the directory path
+	/// \return [bool] true if the directory exists
+	//////////////////////////////////////////////////
+	static bool MakeDirectory(string path);
+	//////////////////////////////////////////////////
+	/// \fn static bool Write(string file, string content)
+	/// \brief Replaces file with content atomically
+	/// \param [in] file is the target path
+	/// \param [in] content is the complete new content
+	/// \return [bool] true if file now holds content, false if file is unchanged
+	///
+	/// - Writes file.tmp, fsync() it, rename() it to file and fsync() the directory
+	///
+	//////////////////////////////////////////////////
+	static bool Write(string file, string content);
+};
+
+} /* namespace SmartDG */
+
+#endif /* DEPENDENCYLITEWRITER_H_ */
@@ -0,0 +1,31 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyMenuHandle.cpp
+/// \brief	Source file for DependencyMenuHandle class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+
+DependencyMenuHandle::DependencyMenuHandle(DependencyMonitor *m,
+		unsigned int i, bool a, bool v) {
+	monitor = m;
+	doiindex = i;
+	all = a;
+	value = v;
+}
+
+DependencyMenuHandle::~DependencyMenuHandle() {
+}
+
+} /* namespace SmartDG */
@@ -0,0 +1,56 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyMenuHandle.h
+/// \brief	Header file for DependencyMenuHandle class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DEPENDENCYMENUHANDLE_H_
+#define DEPENDENCYMENUHANDLE_H_
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+class DependencyMonitor;
+////////////////////////////////////////////////////////////////////////////////
+///	\class DependencyMenuHandle
+/// \brief DependencyMenuHandle class is the user data of an Edit menu item
+///
+/// Every Edit menu item (DependencyMonitor::MonitorWindowMenuBar, GUINode::BarIn and
+/// GUINode::BarOut) carries a pointer to a DependencyMenuHandle naming the DependencyMonitor,
+/// the DependencyObjectInstance and the value it sets, so that a click dispatches straight to
+/// its target instead of matching the selected path against every instance.
+////////////////////////////////////////////////////////////////////////////////
+class DependencyMenuHandle {
+public:
+	DependencyMonitor *monitor; ///< DependencyMonitor owning the menu item
+	unsigned int doiindex; ///< Index of the DependencyObjectInstance in DependencyGraph::DOI
+	bool all; ///< true : sets all udi of the DependencyObject (amid), false : sets the udi only (mid)
+	bool value; ///< Value set
+	//////////////////////////////////////////////////
+	/// \fn DependencyMenuHandle(DependencyMonitor *m, unsigned int i, bool a, bool v)
+	/// \brief Constructor
+	/// \param [in] m is DependencyMenuHandle::monitor
+	/// \param [in] i is DependencyMenuHandle::doiindex
+	/// \param [in] a is DependencyMenuHandle::all
+	/// \param [in] v is DependencyMenuHandle::value
+	//////////////////////////////////////////////////
+	DependencyMenuHandle(DependencyMonitor *m, unsigned int i, bool a, bool v);
+	//////////////////////////////////////////////////
+	/// \fn ~DependencyMenuHandle()
+	/// \brief Default Destructor
+	//////////////////////////////////////////////////
+	virtual ~DependencyMenuHandle();
+};
+
+} /* namespace SmartDG */
+
+#endif /* DEPENDENCYMENUHANDLE_H_ */
@@ -22,6 +22,7 @@ namespace SmartDG {
 DependencyMonitor::DependencyMonitor() {
 	// Initializes data
 	Name = "NA_DM";
+	DG = make_shared<DependencyGraph>();
 	currentView = "NA_V";
 	// Calls DependencyMonitor::setup()
 	setup();
@@ -31,7 +32,7 @@ DependencyMonitor::DependencyMonitor() {
 DependencyMonitor::DependencyMonitor(string GraphAndMonitorName, string mode) {
 	// Initializes data
 	Name = GraphAndMonitorName;
-	DG.Name = GraphAndMonitorName;
+	DG = make_shared<DependencyGraph>(GraphAndMonitorName);
 	Mode = mode;
 	if (Mode == SmartDG_OBJECT_MODE)
 		currentView = "NA_V";
@@ -47,7 +48,7 @@ DependencyMonitor::DependencyMonitor(string MonitorName, string GraphName,
 		string ViewName, string mode) {
 	// Initializes data
 	Name = MonitorName;
-	DG.Name = GraphName;
+	DG = make_shared<DependencyGraph>(GraphName);
 	Mode = mode;
 	currentView = "NA_V";
 	currentComponent = "NA_C";
@@ -60,12 +61,11 @@ DependencyMonitor::DependencyMonitor(string MonitorName, string GraphName,
 	setup();
 }
 
-// Constructor that fills [DG], [Name], [DG.Name], [currentView or currentComponent] and [Mode] from user arguments
-DependencyMonitor::DependencyMonitor(DependencyMonitor from, string MonitorName,
+// Constructor that shares [DG] and fills [Name], [currentView or currentComponent] and [Mode] from user arguments
+DependencyMonitor::DependencyMonitor(const DependencyMonitor &from, string MonitorName,
 		string GraphName, string ViewName, string mode) {
 	// Initializes data
 	Name = MonitorName;
-	DG.Name = GraphName;
 	Mode = mode;
 	currentView = "NA_V";
 	currentComponent = "NA_C";
@@ -76,11 +76,12 @@ DependencyMonitor::DependencyMonitor(DependencyMonitor from, string MonitorName,
 		currentComponent = ViewName;
 	// Calls DependencyMonitor::setup()
 	setup();
-	// Copies from.DG --> DG
+	// Shares from.DG (GraphName is the name of from.DG)
 	DG = from.DG;
 }
 
 void DependencyMonitor::Init() {
+	InitWidgets();
 	MonitorWindow = new Fl_Double_Window(lox, loy,
 	SmartDG_BusinessViewWindowWIDTH, SmartDG_BusinessViewWindowHEIGHT,
 			BusinessViewWindowTitle.c_str());
@@ -121,6 +122,10 @@ void DependencyMonitor::Init() {
 			Static_MonitorWindowMenuBar_Callback, (void*) this);
 	MonitorWindowMenuBar->add("DGMonitor/Print Screen", 0,
 			Static_MonitorWindowMenuBar_Callback, (void*) this);
+	MonitorWindowMenuBar->add("DGMonitor/Trace", 0,
+			Static_MonitorWindowMenuBar_Callback, (void*) this);
+	MonitorWindowMenuBar->add("DGMonitor/Solver Stats", 0,
+			Static_MonitorWindowMenuBar_Callback, (void*) this);
 	MonitorWindowMenuBar->add("DGMonitor/Sync/Allow", 0,
 			Static_MonitorWindowMenuBar_Callback, (void*) this);
 	MonitorWindowMenuBar->add("DGMonitor/Sync/Block", 0,
@@ -147,24 +152,28 @@ void DependencyMonitor::Init() {
 			Static_MonitorWindowMenuBar_Callback, (void*) this);
 	// Edit
 	if (Mode == SmartDG_OBJECT_MODE) {
-		for (unsigned int i = 0; i < DG.DOI.I.size(); i++) {
-			if (DG.DOI.I[i].obj == currentView) {
-				string tmp3 = "Edit/" + DG.DOI.I[i].amidL + "/true";
+		for (unsigned int i = 0; i < DG->DOI.I.size(); i++) {
+			if (DG->DOI.I[i].obj == currentView) {
+				string tmp3 = "Edit/" + DG->DOI.I[i].amidL + "/true";
 				MonitorWindowMenuBar->add(tmp3.c_str(), 0,
-						Static_MonitorWindowMenuBar_Callback, (void*) this);
-				string tmp4 = "Edit/" + DG.DOI.I[i].amidL + "/false";
+						Static_EditMenuBar_Callback,
+						MenuHandle(i, true, true));
+				string tmp4 = "Edit/" + DG->DOI.I[i].amidL + "/false";
 				MonitorWindowMenuBar->add(tmp4.c_str(), 0,
-						Static_MonitorWindowMenuBar_Callback, (void*) this);
+						Static_EditMenuBar_Callback,
+						MenuHandle(i, true, false));
 			}
 		}
-		for (unsigned int i = 0; i < DG.DOI.I.size(); i++) {
-			if (DG.DOI.I[i].obj == currentView) {
-				string tmp1 = "Edit/" + DG.DOI.I[i].midL + "/true";
+		for (unsigned int i = 0; i < DG->DOI.I.size(); i++) {
+			if (DG->DOI.I[i].obj == currentView) {
+				string tmp1 = "Edit/" + DG->DOI.I[i].midL + "/true";
 				MonitorWindowMenuBar->add(tmp1.c_str(), 0,
-						Static_MonitorWindowMenuBar_Callback, (void*) this);
-				string tmp2 = "Edit/" + DG.DOI.I[i].midL + "/false";
+						Static_EditMenuBar_Callback,
+						MenuHandle(i, false, true));
+				string tmp2 = "Edit/" + DG->DOI.I[i].midL + "/false";
 				MonitorWindowMenuBar->add(tmp2.c_str(), 0,
-						Static_MonitorWindowMenuBar_Callback, (void*) this);
+						Static_EditMenuBar_Callback,
+						MenuHandle(i, false, false));
 			}
 		}
 	}
@@ -204,119 +213,127 @@ void DependencyMonitor::Init() {
 	MonitorWindowScroll->label(DispString.c_str());
 	MonitorWindowScroll->begin();
 
-	for (unsigned int i = 0; i < DG.DN.size(); i++) {
-		DG.DN[i].Shape = new Fl_Group(DG.DN[i].x, DG.DN[i].y,
-		SmartDG_COMPWIDTH, SmartDG_COMPHEIGHT, DG.DN[i].Name.c_str());
-		DG.DN[i].Shape->box(FL_UP_BOX);
-		DG.DN[i].Shape->align(FL_ALIGN_BOTTOM_RIGHT);
-		DG.DN[i].Shape->color(SmartDG_NODE_COLOR);
-
-		DG.DN[i].BarIn = new Fl_Menu_Bar(DG.DN[i].x, DG.DN[i].y,
-		SmartDG_NMENUWIDTH, SmartDG_NMENUHEIGHT, DG.DN[i].Name.c_str());
-		DG.DN[i].BarIn->color(SmartDG_NODE_MENU_COLOR);
-		DG.DN[i].BarIn->textcolor(SmartDG_NODE_MENU_TEXT_COLOR);
+	for (unsigned int i = 0; i < DG->DN.size(); i++) {
+		Widgets[i].Shape = new Fl_Group(DG->DN[i].x, DG->DN[i].y,
+		SmartDG_COMPWIDTH, SmartDG_COMPHEIGHT, DG->DN[i].Name.c_str());
+		Widgets[i].Shape->box(FL_UP_BOX);
+		Widgets[i].Shape->align(FL_ALIGN_BOTTOM_RIGHT);
+		Widgets[i].Shape->color(SmartDG_NODE_COLOR);
+
+		Widgets[i].BarIn = new Fl_Menu_Bar(DG->DN[i].x, DG->DN[i].y,
+		SmartDG_NMENUWIDTH, SmartDG_NMENUHEIGHT, DG->DN[i].Name.c_str());
+		Widgets[i].BarIn->color(SmartDG_NODE_MENU_COLOR);
+		Widgets[i].BarIn->textcolor(SmartDG_NODE_MENU_TEXT_COLOR);
 		if (Mode == SmartDG_OBJECT_MODE) {
-			for (unsigned int j = 0; j < DG.DOI.I.size(); j++) {
-				if (DG.DOI.I[j].obj == currentView) {
-					if ((DG.DOI.I[j].pou.strn == DG.DN[i].Name)
-							&& (DG.DOI.I[j].pou.strio == "In")) {
-						DG.DN[i].BarIn->add(
-								string("✎/" + DG.DOI.I[j].amid + "/true").c_str(),
-								0, Static_NodeMenuBar_Callback, (void*) this);
-						DG.DN[i].BarIn->add(
-								string("✎/" + DG.DOI.I[j].amid + "/false").c_str(),
-								0, Static_NodeMenuBar_Callback, (void*) this);
+			for (unsigned int j = 0; j < DG->DOI.I.size(); j++) {
+				if (DG->DOI.I[j].obj == currentView) {
+					if ((DG->DOI.I[j].pou.strn() == DG->DN[i].Name)
+							&& (DG->DOI.I[j].pou.strio() == "In")) {
+						Widgets[i].BarIn->add(
+								string("✎/" + DG->DOI.I[j].amid + "/true").c_str(),
+								0, Static_NodeMenuBar_Callback,
+								MenuHandle(j, true, true));
+						Widgets[i].BarIn->add(
+								string("✎/" + DG->DOI.I[j].amid + "/false").c_str(),
+								0, Static_NodeMenuBar_Callback,
+								MenuHandle(j, true, false));
 					}
 				}
 			}
-			for (unsigned int j = 0; j < DG.DOI.I.size(); j++) {
-				if (DG.DOI.I[j].obj == currentView) {
-					if ((DG.DOI.I[j].pou.strn == DG.DN[i].Name)
-							&& (DG.DOI.I[j].pou.strio == "In")) {
-						DG.DN[i].BarIn->add(
-								string("✎/" + DG.DOI.I[j].mid + "/true").c_str(),
-								0, Static_NodeMenuBar_Callback, (void*) this);
-						DG.DN[i].BarIn->add(
-								string("✎/" + DG.DOI.I[j].mid + "/false").c_str(),
-								0, Static_NodeMenuBar_Callback, (void*) this);
+			for (unsigned int j = 0; j < DG->DOI.I.size(); j++) {
+				if (DG->DOI.I[j].obj == currentView) {
+					if ((DG->DOI.I[j].pou.strn() == DG->DN[i].Name)
+							&& (DG->DOI.I[j].pou.strio() == "In")) {
+						Widgets[i].BarIn->add(
+								string("✎/" + DG->DOI.I[j].mid + "/true").c_str(),
+								0, Static_NodeMenuBar_Callback,
+								MenuHandle(j, false, true));
+						Widgets[i].BarIn->add(
+								string("✎/" + DG->DOI.I[j].mid + "/false").c_str(),
+								0, Static_NodeMenuBar_Callback,
+								MenuHandle(j, false, false));
 					}
 				}
 			}
 		}
 
-		DG.DN[i].BarOut = new Fl_Menu_Bar(
-				DG.DN[i].x + SmartDG_COMPWIDTH - SmartDG_NMENUWIDTH, DG.DN[i].y,
-				SmartDG_NMENUWIDTH, SmartDG_NMENUHEIGHT, DG.DN[i].Name.c_str());
-		DG.DN[i].BarOut->color(SmartDG_NODE_MENU_COLOR);
-		DG.DN[i].BarOut->textcolor(SmartDG_NODE_MENU_TEXT_COLOR);
+		Widgets[i].BarOut = new Fl_Menu_Bar(
+				DG->DN[i].x + SmartDG_COMPWIDTH - SmartDG_NMENUWIDTH, DG->DN[i].y,
+				SmartDG_NMENUWIDTH, SmartDG_NMENUHEIGHT, DG->DN[i].Name.c_str());
+		Widgets[i].BarOut->color(SmartDG_NODE_MENU_COLOR);
+		Widgets[i].BarOut->textcolor(SmartDG_NODE_MENU_TEXT_COLOR);
 		if (Mode == SmartDG_OBJECT_MODE) {
-			for (unsigned int j = 0; j < DG.DOI.I.size(); j++) {
-				if (DG.DOI.I[j].obj == currentView) {
-					if ((DG.DOI.I[j].pou.strn == DG.DN[i].Name)
-							&& (DG.DOI.I[j].pou.strio == "Out")) {
-						DG.DN[i].BarOut->add(
-								string("✎/" + DG.DOI.I[j].amid + "/true").c_str(),
-								0, Static_NodeMenuBar_Callback, (void*) this);
-						DG.DN[i].BarOut->add(
-								string("✎/" + DG.DOI.I[j].amid + "/false").c_str(),
-								0, Static_NodeMenuBar_Callback, (void*) this);
+			for (unsigned int j = 0; j < DG->DOI.I.size(); j++) {
+				if (DG->DOI.I[j].obj == currentView) {
+					if ((DG->DOI.I[j].pou.strn() == DG->DN[i].Name)
+							&& (DG->DOI.I[j].pou.strio() == "Out")) {
+						Widgets[i].BarOut->add(
+								string("✎/" + DG->DOI.I[j].amid + "/true").c_str(),
+								0, Static_NodeMenuBar_Callback,
+								MenuHandle(j, true, true));
+						Widgets[i].BarOut->add(
+								string("✎/" + DG->DOI.I[j].amid + "/false").c_str(),
+								0, Static_NodeMenuBar_Callback,
+								MenuHandle(j, true, false));
 					}
 				}
 			}
-			for (unsigned int j = 0; j < DG.DOI.I.size(); j++) {
-				if (DG.DOI.I[j].obj == currentView) {
-					if ((DG.DOI.I[j].pou.strn == DG.DN[i].Name)
-							&& (DG.DOI.I[j].pou.strio == "Out")) {
-						DG.DN[i].BarOut->add(
-								string("✎/" + DG.DOI.I[j].mid + "/true").c_str(),
-								0, Static_NodeMenuBar_Callback, (void*) this);
-						DG.DN[i].BarOut->add(
-								string("✎/" + DG.DOI.I[j].mid + "/false").c_str(),
-								0, Static_NodeMenuBar_Callback, (void*) this);
+			for (unsigned int j = 0; j < DG->DOI.I.size(); j++) {
+				if (DG->DOI.I[j].obj == currentView) {
+					if ((DG->DOI.I[j].pou.strn() == DG->DN[i].Name)
+							&& (DG->DOI.I[j].pou.strio() == "Out")) {
+						Widgets[i].BarOut->add(
+								string("✎/" + DG->DOI.I[j].mid + "/true").c_str(),
+								0, Static_NodeMenuBar_Callback,
+								MenuHandle(j, false, true));
+						Widgets[i].BarOut->add(
+								string("✎/" + DG->DOI.I[j].mid + "/false").c_str(),
+								0, Static_NodeMenuBar_Callback,
+								MenuHandle(j, false, false));
 					}
 				}
 			}
 		}
 
-		DG.DN[i].ShapeI = new Fl_Group(DG.DN[i].x + SmartDG_IX, DG.DN[i].y + 2,
+		Widgets[i].ShapeI = new Fl_Group(DG->DN[i].x + SmartDG_IX, DG->DN[i].y + 2,
 		SmartDG_IW, SmartDG_COMPHEIGHT - 4, "In");
-		DG.DN[i].ShapeI->box(FL_BORDER_FRAME);
-		DG.DN[i].ShapeI->color(SmartDG_GUIDECOLOR);
-		DG.DN[i].ShapeI->align(FL_ALIGN_TOP);
-		unsigned int CursorI = DG.DN[i].y + 2;
-		for (unsigned int j = 0; j < DG.DN[i].DP[0].size(); j++) {
-			DG.DN[i].DP[0][j].Shape = new Fl_Group(DG.DN[i].x + SmartDG_IX,
+		Widgets[i].ShapeI->box(FL_BORDER_FRAME);
+		Widgets[i].ShapeI->color(SmartDG_GUIDECOLOR);
+		Widgets[i].ShapeI->align(FL_ALIGN_TOP);
+		unsigned int CursorI = DG->DN[i].y + 2;
+		for (unsigned int j = 0; j < DG->DN[i].DP[0].size(); j++) {
+			Widgets[i].PortShape[0][j] = new Fl_Group(DG->DN[i].x + SmartDG_IX,
 					CursorI, SmartDG_IW, SmartDG_IW,
-					DG.DN[i].DP[0][j].Name.c_str());
+					DG->DN[i].DP[0][j].Name.c_str());
 			unsigned int t;
 			if (SmartDG_COMPRESSFLAG)
 				t = CursorI + SmartDG_IW;
 			else
 				CursorI += SmartDG_IW;
-			DG.DN[i].DP[0][j].Shape->box(SmartDG_INOUTPORT_SHAPE);
-			DG.DN[i].DP[0][j].Shape->color(SmartDG_NODE_IN_USE_COLOR);
-			DG.DN[i].DP[0][j].Shape->labelcolor(SmartDG_NODE_IN_USE_COLOR);
-			DG.DN[i].DP[0][j].Shape->align(FL_ALIGN_LEFT);
-			for (unsigned int l = 0; l < DG.DN[i].DP[0][j].DO.size(); l++) {
-				DG.DN[i].DP[0][j].DO[l].Shape = new Fl_Group(
-						DG.DN[i].x + SmartDG_IXX, CursorI, SmartDG_IWW,
-						SmartDG_IWW, DG.DN[i].DP[0][j].DO[l].Name.c_str());
+			Widgets[i].PortShape[0][j]->box(SmartDG_INOUTPORT_SHAPE);
+			Widgets[i].PortShape[0][j]->color(SmartDG_NODE_IN_USE_COLOR);
+			Widgets[i].PortShape[0][j]->labelcolor(SmartDG_NODE_IN_USE_COLOR);
+			Widgets[i].PortShape[0][j]->align(FL_ALIGN_LEFT);
+			for (unsigned int l = 0; l < DG->DN[i].DP[0][j].DO.size(); l++) {
+				Widgets[i].ObjectShape[0][j][l] = new Fl_Group(
+						DG->DN[i].x + SmartDG_IXX, CursorI, SmartDG_IWW,
+						SmartDG_IWW, DG->DN[i].DP[0][j].DO[l].Name.c_str());
 				CursorI += SmartDG_IWW + 1;
-				DG.DN[i].DP[0][j].DO[l].Shape->box(SmartDG_INOUTOBJECT_SHAPE);
+				Widgets[i].ObjectShape[0][j][l]->box(SmartDG_INOUTOBJECT_SHAPE);
 				if (Mode == SmartDG_OBJECT_MODE) {
-					if (DG.DN[i].DP[0][j].DO[l].Name == currentView) {
-						DG.DN[i].DP[0][j].DO[l].Shape->color(
+					if (DG->DN[i].DP[0][j].DO[l].Name == currentView) {
+						Widgets[i].ObjectShape[0][j][l]->color(
 						SmartDG_NODE_IN_USE_COLOR);
-						DG.DN[i].DP[0][j].DO[l].Shape->labelcolor(
+						Widgets[i].ObjectShape[0][j][l]->labelcolor(
 						SmartDG_NODE_IN_USE_COLOR);
 					} else {
-						DG.DN[i].DP[0][j].DO[l].Shape->color(
+						Widgets[i].ObjectShape[0][j][l]->color(
 						SmartDG_NODE_IN_NOUSE_COLOR);
-						DG.DN[i].DP[0][j].DO[l].Shape->labelcolor(
+						Widgets[i].ObjectShape[0][j][l]->labelcolor(
 						SmartDG_NODE_IN_NOUSE_COLOR);
 					}
 				}
-				DG.DN[i].DP[0][j].DO[l].Shape->align(FL_ALIGN_RIGHT);
+				Widgets[i].ObjectShape[0][j][l]->align(FL_ALIGN_RIGHT);
 			}
 			if (SmartDG_COMPRESSFLAG) {
 				if (CursorI <= t)
@@ -326,49 +343,49 @@ void DependencyMonitor::Init() {
 			}
 		}
 
-		DG.DN[i].ShapeO = new Fl_Group(
-				DG.DN[i].x + SmartDG_COMPWIDTH - SmartDG_IX - SmartDG_IW,
-				DG.DN[i].y + 2,
+		Widgets[i].ShapeO = new Fl_Group(
+				DG->DN[i].x + SmartDG_COMPWIDTH - SmartDG_IX - SmartDG_IW,
+				DG->DN[i].y + 2,
 				SmartDG_IW, SmartDG_COMPHEIGHT - 4, "Out");
-		DG.DN[i].ShapeO->box(FL_BORDER_FRAME);
-		DG.DN[i].ShapeO->color(SmartDG_GUIDECOLOR);
-		DG.DN[i].ShapeO->align(FL_ALIGN_TOP);
-		unsigned int CursorO = DG.DN[i].y + 2;
-		for (unsigned int j = 0; j < DG.DN[i].DP[1].size(); j++) {
-			DG.DN[i].DP[1][j].Shape = new Fl_Group(
-					DG.DN[i].x + SmartDG_COMPWIDTH - SmartDG_IX - SmartDG_IW,
+		Widgets[i].ShapeO->box(FL_BORDER_FRAME);
+		Widgets[i].ShapeO->color(SmartDG_GUIDECOLOR);
+		Widgets[i].ShapeO->align(FL_ALIGN_TOP);
+		unsigned int CursorO = DG->DN[i].y + 2;
+		for (unsigned int j = 0; j < DG->DN[i].DP[1].size(); j++) {
+			Widgets[i].PortShape[1][j] = new Fl_Group(
+					DG->DN[i].x + SmartDG_COMPWIDTH - SmartDG_IX - SmartDG_IW,
 					CursorO, SmartDG_IW, SmartDG_IW,
-					DG.DN[i].DP[1][j].Name.c_str());
+					DG->DN[i].DP[1][j].Name.c_str());
 			unsigned int t;
 			if (SmartDG_COMPRESSFLAG)
 				t = CursorO + SmartDG_IW;
 			else
 				CursorO += SmartDG_IW;
-			DG.DN[i].DP[1][j].Shape->box(SmartDG_INOUTPORT_SHAPE);
-			DG.DN[i].DP[1][j].Shape->color(SmartDG_NODE_OUT_USE_COLOR);
-			DG.DN[i].DP[1][j].Shape->labelcolor(SmartDG_NODE_OUT_USE_COLOR);
-			DG.DN[i].DP[1][j].Shape->align(FL_ALIGN_RIGHT);
-			for (unsigned int l = 0; l < DG.DN[i].DP[1][j].DO.size(); l++) {
-				DG.DN[i].DP[1][j].DO[l].Shape = new Fl_Group(
-						DG.DN[i].x + SmartDG_COMPWIDTH - SmartDG_IXX
+			Widgets[i].PortShape[1][j]->box(SmartDG_INOUTPORT_SHAPE);
+			Widgets[i].PortShape[1][j]->color(SmartDG_NODE_OUT_USE_COLOR);
+			Widgets[i].PortShape[1][j]->labelcolor(SmartDG_NODE_OUT_USE_COLOR);
+			Widgets[i].PortShape[1][j]->align(FL_ALIGN_RIGHT);
+			for (unsigned int l = 0; l < DG->DN[i].DP[1][j].DO.size(); l++) {
+				Widgets[i].ObjectShape[1][j][l] = new Fl_Group(
+						DG->DN[i].x + SmartDG_COMPWIDTH - SmartDG_IXX
 								- SmartDG_IWW, CursorO, SmartDG_IWW,
-						SmartDG_IWW, DG.DN[i].DP[1][j].DO[l].Name.c_str());
+						SmartDG_IWW, DG->DN[i].DP[1][j].DO[l].Name.c_str());
 				CursorO += SmartDG_IWW + 1;
-				DG.DN[i].DP[1][j].DO[l].Shape->box(SmartDG_INOUTOBJECT_SHAPE);
+				Widgets[i].ObjectShape[1][j][l]->box(SmartDG_INOUTOBJECT_SHAPE);
 				if (Mode == SmartDG_OBJECT_MODE) {
-					if (DG.DN[i].DP[1][j].DO[l].Name == currentView) {
-						DG.DN[i].DP[1][j].DO[l].Shape->color(
+					if (DG->DN[i].DP[1][j].DO[l].Name == currentView) {
+						Widgets[i].ObjectShape[1][j][l]->color(
 						SmartDG_NODE_OUT_USE_COLOR);
-						DG.DN[i].DP[1][j].DO[l].Shape->labelcolor(
+						Widgets[i].ObjectShape[1][j][l]->labelcolor(
 						SmartDG_NODE_OUT_USE_COLOR);
 					} else {
-						DG.DN[i].DP[1][j].DO[l].Shape->color(
+						Widgets[i].ObjectShape[1][j][l]->color(
 						SmartDG_NODE_OUT_NOUSE_COLOR);
-						DG.DN[i].DP[1][j].DO[l].Shape->labelcolor(
+						Widgets[i].ObjectShape[1][j][l]->labelcolor(
 						SmartDG_NODE_OUT_NOUSE_COLOR);
 					}
 				}
-				DG.DN[i].DP[1][j].DO[l].Shape->align(FL_ALIGN_LEFT);
+				Widgets[i].ObjectShape[1][j][l]->align(FL_ALIGN_LEFT);
 			}
 			if (SmartDG_COMPRESSFLAG) {
 				if (CursorO <= t)
@@ -381,32 +398,32 @@ void DependencyMonitor::Init() {
 
 		if ((CursorMax > SmartDG_COMPHEIGHT)
 				|| !(SmartDG_FIX_COMP_MIN_HEIGHT)) {
-			DG.DN[i].Shape->resize(DG.DN[i].x, DG.DN[i].y,
-			SmartDG_COMPWIDTH, CursorMax - DG.DN[i].y + SmartDG_IW);
+			Widgets[i].Shape->resize(DG->DN[i].x, DG->DN[i].y,
+			SmartDG_COMPWIDTH, CursorMax - DG->DN[i].y + SmartDG_IW);
 			// Readjusts after Node Shape resize
-			DG.DN[i].ShapeI->resize(DG.DN[i].x + SmartDG_IX, DG.DN[i].y + 2,
-			SmartDG_IW, CursorMax - DG.DN[i].y + SmartDG_IW - 4);
-			DG.DN[i].BarIn->resize(DG.DN[i].x, DG.DN[i].y,
+			Widgets[i].ShapeI->resize(DG->DN[i].x + SmartDG_IX, DG->DN[i].y + 2,
+			SmartDG_IW, CursorMax - DG->DN[i].y + SmartDG_IW - 4);
+			Widgets[i].BarIn->resize(DG->DN[i].x, DG->DN[i].y,
 			SmartDG_NMENUWIDTH, SmartDG_NMENUHEIGHT);
-			if (DG.DN[i].DP[0].size() > 0)
-				DG.DN[i].DP[0][0].Shape->resize(DG.DN[i].x + SmartDG_IX,
-						DG.DN[i].y + 2,
+			if (DG->DN[i].DP[0].size() > 0)
+				Widgets[i].PortShape[0][0]->resize(DG->DN[i].x + SmartDG_IX,
+						DG->DN[i].y + 2,
 						SmartDG_IW, SmartDG_IW);
-			DG.DN[i].ShapeO->resize(
-					DG.DN[i].x + SmartDG_COMPWIDTH - SmartDG_IX - SmartDG_IW,
-					DG.DN[i].y + 2,
-					SmartDG_IW, CursorMax - DG.DN[i].y + SmartDG_IW - 4);
-			DG.DN[i].BarOut->resize(
-					DG.DN[i].x + SmartDG_COMPWIDTH - SmartDG_NMENUWIDTH,
-					DG.DN[i].y,
+			Widgets[i].ShapeO->resize(
+					DG->DN[i].x + SmartDG_COMPWIDTH - SmartDG_IX - SmartDG_IW,
+					DG->DN[i].y + 2,
+					SmartDG_IW, CursorMax - DG->DN[i].y + SmartDG_IW - 4);
+			Widgets[i].BarOut->resize(
+					DG->DN[i].x + SmartDG_COMPWIDTH - SmartDG_NMENUWIDTH,
+					DG->DN[i].y,
 					SmartDG_NMENUWIDTH, SmartDG_NMENUHEIGHT);
-			if (DG.DN[i].DP[1].size() > 0)
-				DG.DN[i].DP[1][0].Shape->resize(
-						DG.DN[i].x + SmartDG_COMPWIDTH - SmartDG_IX - SmartDG_IW,
-						DG.DN[i].y + 2,
+			if (DG->DN[i].DP[1].size() > 0)
+				Widgets[i].PortShape[1][0]->resize(
+						DG->DN[i].x + SmartDG_COMPWIDTH - SmartDG_IX - SmartDG_IW,
+						DG->DN[i].y + 2,
 						SmartDG_IW, SmartDG_IW);
 		}
-		DG.DN[i].Shape->end();
+		Widgets[i].Shape->end();
 	}
 	Generate_Dependency_Tabs();
 	ShowLines();
@@ -417,6 +434,7 @@ void DependencyMonitor::Init() {
 }
 
 void DependencyMonitor::InitComponent() {
+	InitWidgets();
 	MonitorWindow = new Fl_Double_Window(lox, loy,
 	SmartDG_COMPONENTMODE_BusinessViewWindowWIDTH,
 	SmartDG_COMPONENTMODE_BusinessViewWindowHEIGHT,
@@ -458,6 +476,10 @@ void DependencyMonitor::InitComponent() {
 			Static_MonitorWindowMenuBar_Callback, (void*) this);
 	MonitorWindowMenuBar->add("DGMonitor/Print Screen", 0,
 			Static_MonitorWindowMenuBar_Callback, (void*) this);
+	MonitorWindowMenuBar->add("DGMonitor/Trace", 0,
+			Static_MonitorWindowMenuBar_Callback, (void*) this);
+	MonitorWindowMenuBar->add("DGMonitor/Solver Stats", 0,
+			Static_MonitorWindowMenuBar_Callback, (void*) this);
 	if (Mode != SmartDG_COMPONENT_DEVELOPER_MODE) {
 		MonitorWindowMenuBar->add("DGMonitor/Sync/Allow", 0,
 				Static_MonitorWindowMenuBar_Callback, (void*) this);
@@ -487,24 +509,28 @@ void DependencyMonitor::InitComponent() {
 	// Edit
 	if ((Mode == SmartDG_COMPONENT_MODE)
 			|| (Mode == SmartDG_COMPONENT_DEVELOPER_MODE)) {
-		for (unsigned int i = 0; i < DG.DOI.I.size(); i++) {
-			if (DG.DOI.I[i].pou.strn == currentComponent) {
-				string tmp3 = "Edit/" + DG.DOI.I[i].amidL + "/true";
+		for (unsigned int i = 0; i < DG->DOI.I.size(); i++) {
+			if (DG->DOI.I[i].pou.strn() == currentComponent) {
+				string tmp3 = "Edit/" + DG->DOI.I[i].amidL + "/true";
 				MonitorWindowMenuBar->add(tmp3.c_str(), 0,
-						Static_MonitorWindowMenuBar_Callback, (void*) this);
-				string tmp4 = "Edit/" + DG.DOI.I[i].amidL + "/false";
+						Static_EditMenuBar_Callback,
+						MenuHandle(i, true, true));
+				string tmp4 = "Edit/" + DG->DOI.I[i].amidL + "/false";
 				MonitorWindowMenuBar->add(tmp4.c_str(), 0,
-						Static_MonitorWindowMenuBar_Callback, (void*) this);
+						Static_EditMenuBar_Callback,
+						MenuHandle(i, true, false));
 			}
 		}
-		for (unsigned int i = 0; i < DG.DOI.I.size(); i++) {
-			if (DG.DOI.I[i].pou.strn == currentComponent) {
-				string tmp1 = "Edit/" + DG.DOI.I[i].midL + "/true";
+		for (unsigned int i = 0; i < DG->DOI.I.size(); i++) {
+			if (DG->DOI.I[i].pou.strn() == currentComponent) {
+				string tmp1 = "Edit/" + DG->DOI.I[i].midL + "/true";
 				MonitorWindowMenuBar->add(tmp1.c_str(), 0,
-						Static_MonitorWindowMenuBar_Callback, (void*) this);
-				string tmp2 = "Edit/" + DG.DOI.I[i].midL + "/false";
+						Static_EditMenuBar_Callback,
+						MenuHandle(i, false, true));
+				string tmp2 = "Edit/" + DG->DOI.I[i].midL + "/false";
 				MonitorWindowMenuBar->add(tmp2.c_str(), 0,
-						Static_MonitorWindowMenuBar_Callback, (void*) this);
+						Static_EditMenuBar_Callback,
+						MenuHandle(i, false, false));
 			}
 		}
 	}
@@ -549,129 +575,129 @@ void DependencyMonitor::InitComponent() {
 	MonitorWindowScroll->begin();
 
 	unsigned int midx = SmartDG_COMPONENTMODE_BusinessViewWindowWIDTH/2;
-	for (unsigned int i = 0; i < DG.DN.size(); i++) {
-		if (DG.DN[i].Name == currentComponent) {
+	for (unsigned int i = 0; i < DG->DN.size(); i++) {
+		if (DG->DN[i].Name == currentComponent) {
 
 			unsigned int nodex = midx - SmartDG_COMPWIDTH / 2;
 			unsigned int nodey = SmartDG_COMPONENTMODE_MARGIN_TOP;
 
-			DG.DN[i].Shape = new Fl_Group(nodex, nodey,
-			SmartDG_COMPWIDTH, SmartDG_COMPHEIGHT, DG.DN[i].Name.c_str());
-			DG.DN[i].Shape->box(FL_UP_BOX);
-			DG.DN[i].Shape->align(FL_ALIGN_BOTTOM_RIGHT);
-			DG.DN[i].Shape->color(SmartDG_NODE_COLOR);
+			Widgets[i].Shape = new Fl_Group(nodex, nodey,
+			SmartDG_COMPWIDTH, SmartDG_COMPHEIGHT, DG->DN[i].Name.c_str());
+			Widgets[i].Shape->box(FL_UP_BOX);
+			Widgets[i].Shape->align(FL_ALIGN_BOTTOM_RIGHT);
+			Widgets[i].Shape->color(SmartDG_NODE_COLOR);
 
-			DG.DN[i].BarIn = new Fl_Menu_Bar(nodex, nodey,
-			SmartDG_NMENUWIDTH, SmartDG_NMENUHEIGHT, DG.DN[i].Name.c_str());
-			DG.DN[i].BarIn->color(SmartDG_NODE_MENU_COLOR);
-			DG.DN[i].BarIn->textcolor(SmartDG_NODE_MENU_TEXT_COLOR);
+			Widgets[i].BarIn = new Fl_Menu_Bar(nodex, nodey,
+			SmartDG_NMENUWIDTH, SmartDG_NMENUHEIGHT, DG->DN[i].Name.c_str());
+			Widgets[i].BarIn->color(SmartDG_NODE_MENU_COLOR);
+			Widgets[i].BarIn->textcolor(SmartDG_NODE_MENU_TEXT_COLOR);
 			if ((Mode == SmartDG_COMPONENT_MODE)
 					|| (Mode == SmartDG_COMPONENT_DEVELOPER_MODE)) {
-				for (unsigned int j = 0; j < DG.DOI.I.size(); j++) {
-					if (DG.DOI.I[j].pou.strn == currentComponent) {
-						if ((DG.DOI.I[j].pou.strn == DG.DN[i].Name)
-								&& (DG.DOI.I[j].pou.strio == "In")) {
-							DG.DN[i].BarIn->add(
-									string("✎/" + DG.DOI.I[j].amid + "/true").c_str(),
+				for (unsigned int j = 0; j < DG->DOI.I.size(); j++) {
+					if (DG->DOI.I[j].pou.strn() == currentComponent) {
+						if ((DG->DOI.I[j].pou.strn() == DG->DN[i].Name)
+								&& (DG->DOI.I[j].pou.strio() == "In")) {
+							Widgets[i].BarIn->add(
+									string("✎/" + DG->DOI.I[j].amid + "/true").c_str(),
 									0, Static_NodeMenuBar_Callback,
-									(void*) this);
-							DG.DN[i].BarIn->add(
-									string("✎/" + DG.DOI.I[j].amid + "/false").c_str(),
+									MenuHandle(j, true, true));
+							Widgets[i].BarIn->add(
+									string("✎/" + DG->DOI.I[j].amid + "/false").c_str(),
 									0, Static_NodeMenuBar_Callback,
-									(void*) this);
+									MenuHandle(j, true, false));
 						}
 					}
 				}
-				for (unsigned int j = 0; j < DG.DOI.I.size(); j++) {
-					if (DG.DOI.I[j].pou.strn == currentComponent) {
-						if ((DG.DOI.I[j].pou.strn == DG.DN[i].Name)
-								&& (DG.DOI.I[j].pou.strio == "In")) {
-							DG.DN[i].BarIn->add(
-									string("✎/" + DG.DOI.I[j].mid + "/true").c_str(),
+				for (unsigned int j = 0; j < DG->DOI.I.size(); j++) {
+					if (DG->DOI.I[j].pou.strn() == currentComponent) {
+						if ((DG->DOI.I[j].pou.strn() == DG->DN[i].Name)
+								&& (DG->DOI.I[j].pou.strio() == "In")) {
+							Widgets[i].BarIn->add(
+									string("✎/" + DG->DOI.I[j].mid + "/true").c_str(),
 									0, Static_NodeMenuBar_Callback,
-									(void*) this);
-							DG.DN[i].BarIn->add(
-									string("✎/" + DG.DOI.I[j].mid + "/false").c_str(),
+									MenuHandle(j, false, true));
+							Widgets[i].BarIn->add(
+									string("✎/" + DG->DOI.I[j].mid + "/false").c_str(),
 									0, Static_NodeMenuBar_Callback,
-									(void*) this);
+									MenuHandle(j, false, false));
 						}
 					}
 				}
 			}
 
-			DG.DN[i].BarOut = new Fl_Menu_Bar(
+			Widgets[i].BarOut = new Fl_Menu_Bar(
 					nodex + SmartDG_COMPWIDTH - SmartDG_NMENUWIDTH, nodey,
 					SmartDG_NMENUWIDTH, SmartDG_NMENUHEIGHT,
-					DG.DN[i].Name.c_str());
-			DG.DN[i].BarOut->color(SmartDG_NODE_MENU_COLOR);
-			DG.DN[i].BarOut->textcolor(SmartDG_NODE_MENU_TEXT_COLOR);
+					DG->DN[i].Name.c_str());
+			Widgets[i].BarOut->color(SmartDG_NODE_MENU_COLOR);
+			Widgets[i].BarOut->textcolor(SmartDG_NODE_MENU_TEXT_COLOR);
 			if ((Mode == SmartDG_COMPONENT_MODE)
 					|| (Mode == SmartDG_COMPONENT_DEVELOPER_MODE)) {
-				for (unsigned int j = 0; j < DG.DOI.I.size(); j++) {
-					if (DG.DOI.I[j].pou.strn == currentComponent) {
-						if ((DG.DOI.I[j].pou.strn == DG.DN[i].Name)
-								&& (DG.DOI.I[j].pou.strio == "Out")) {
-							DG.DN[i].BarOut->add(
-									string("✎/" + DG.DOI.I[j].amid + "/true").c_str(),
+				for (unsigned int j = 0; j < DG->DOI.I.size(); j++) {
+					if (DG->DOI.I[j].pou.strn() == currentComponent) {
+						if ((DG->DOI.I[j].pou.strn() == DG->DN[i].Name)
+								&& (DG->DOI.I[j].pou.strio() == "Out")) {
+							Widgets[i].BarOut->add(
+									string("✎/" + DG->DOI.I[j].amid + "/true").c_str(),
 									0, Static_NodeMenuBar_Callback,
-									(void*) this);
-							DG.DN[i].BarOut->add(
-									string("✎/" + DG.DOI.I[j].amid + "/false").c_str(),
+									MenuHandle(j, true, true));
+							Widgets[i].BarOut->add(
+									string("✎/" + DG->DOI.I[j].amid + "/false").c_str(),
 									0, Static_NodeMenuBar_Callback,
-									(void*) this);
+									MenuHandle(j, true, false));
 						}
 					}
 				}
-				for (unsigned int j = 0; j < DG.DOI.I.size(); j++) {
-					if (DG.DOI.I[j].pou.strn == currentComponent) {
-						if ((DG.DOI.I[j].pou.strn == DG.DN[i].Name)
-								&& (DG.DOI.I[j].pou.strio == "Out")) {
-							DG.DN[i].BarOut->add(
-									string("✎/" + DG.DOI.I[j].mid + "/true").c_str(),
+				for (unsigned int j = 0; j < DG->DOI.I.size(); j++) {
+					if (DG->DOI.I[j].pou.strn() == currentComponent) {
+						if ((DG->DOI.I[j].pou.strn() == DG->DN[i].Name)
+								&& (DG->DOI.I[j].pou.strio() == "Out")) {
+							Widgets[i].BarOut->add(
+									string("✎/" + DG->DOI.I[j].mid + "/true").c_str(),
 									0, Static_NodeMenuBar_Callback,
-									(void*) this);
-							DG.DN[i].BarOut->add(
-									string("✎/" + DG.DOI.I[j].mid + "/false").c_str(),
+									MenuHandle(j, false, true));
+							Widgets[i].BarOut->add(
+									string("✎/" + DG->DOI.I[j].mid + "/false").c_str(),
 									0, Static_NodeMenuBar_Callback,
-									(void*) this);
+									MenuHandle(j, false, false));
 						}
 					}
 				}
 			}
-			DG.DN[i].ShapeI = new Fl_Group(nodex + SmartDG_IX, nodey + 2,
+			Widgets[i].ShapeI = new Fl_Group(nodex + SmartDG_IX, nodey + 2,
 			SmartDG_IW, SmartDG_COMPHEIGHT - 4, "In");
-			DG.DN[i].ShapeI->box(FL_BORDER_FRAME);
-			DG.DN[i].ShapeI->color(SmartDG_GUIDECOLOR);
-			DG.DN[i].ShapeI->align(FL_ALIGN_TOP);
+			Widgets[i].ShapeI->box(FL_BORDER_FRAME);
+			Widgets[i].ShapeI->color(SmartDG_GUIDECOLOR);
+			Widgets[i].ShapeI->align(FL_ALIGN_TOP);
 			unsigned int CursorI = nodey + 2;
-			for (unsigned int j = 0; j < DG.DN[i].DP[0].size(); j++) {
-				DG.DN[i].DP[0][j].Shape = new Fl_Group(nodex + SmartDG_IX,
+			for (unsigned int j = 0; j < DG->DN[i].DP[0].size(); j++) {
+				Widgets[i].PortShape[0][j] = new Fl_Group(nodex + SmartDG_IX,
 						CursorI, SmartDG_IW, SmartDG_IW,
-						DG.DN[i].DP[0][j].Name.c_str());
+						DG->DN[i].DP[0][j].Name.c_str());
 				unsigned int t;
 				if (SmartDG_COMPRESSFLAG)
 					t = CursorI + SmartDG_IW;
 				else
 					CursorI += SmartDG_IW;
-				DG.DN[i].DP[0][j].Shape->box(SmartDG_INOUTPORT_SHAPE);
-				DG.DN[i].DP[0][j].Shape->color(SmartDG_NODE_IN_USE_COLOR);
-				DG.DN[i].DP[0][j].Shape->labelcolor(SmartDG_NODE_IN_USE_COLOR);
-				DG.DN[i].DP[0][j].Shape->align(FL_ALIGN_LEFT);
-				for (unsigned int l = 0; l < DG.DN[i].DP[0][j].DO.size(); l++) {
-					DG.DN[i].DP[0][j].DO[l].Shape = new Fl_Group(
+				Widgets[i].PortShape[0][j]->box(SmartDG_INOUTPORT_SHAPE);
+				Widgets[i].PortShape[0][j]->color(SmartDG_NODE_IN_USE_COLOR);
+				Widgets[i].PortShape[0][j]->labelcolor(SmartDG_NODE_IN_USE_COLOR);
+				Widgets[i].PortShape[0][j]->align(FL_ALIGN_LEFT);
+				for (unsigned int l = 0; l < DG->DN[i].DP[0][j].DO.size(); l++) {
+					Widgets[i].ObjectShape[0][j][l] = new Fl_Group(
 							nodex + SmartDG_IXX, CursorI, SmartDG_IWW,
-							SmartDG_IWW, DG.DN[i].DP[0][j].DO[l].Name.c_str());
+							SmartDG_IWW, DG->DN[i].DP[0][j].DO[l].Name.c_str());
 					CursorI += SmartDG_IWW + 1;
-					DG.DN[i].DP[0][j].DO[l].Shape->box(
+					Widgets[i].ObjectShape[0][j][l]->box(
 					SmartDG_INOUTOBJECT_SHAPE);
 					if ((Mode == SmartDG_COMPONENT_MODE)
 							|| (Mode == SmartDG_COMPONENT_DEVELOPER_MODE)) {
-						DG.DN[i].DP[0][j].DO[l].Shape->color(
+						Widgets[i].ObjectShape[0][j][l]->color(
 						SmartDG_NODE_IN_USE_COLOR);
-						DG.DN[i].DP[0][j].DO[l].Shape->labelcolor(
+						Widgets[i].ObjectShape[0][j][l]->labelcolor(
 						SmartDG_NODE_IN_USE_COLOR);
 					}
-					DG.DN[i].DP[0][j].DO[l].Shape->align(FL_ALIGN_RIGHT);
+					Widgets[i].ObjectShape[0][j][l]->align(FL_ALIGN_RIGHT);
 				}
 				if (SmartDG_COMPRESSFLAG) {
 					if (CursorI <= t)
@@ -681,44 +707,44 @@ void DependencyMonitor::InitComponent() {
 				}
 			}
 
-			DG.DN[i].ShapeO = new Fl_Group(
+			Widgets[i].ShapeO = new Fl_Group(
 					nodex + SmartDG_COMPWIDTH - SmartDG_IX - SmartDG_IW,
 					nodey + 2,
 					SmartDG_IW, SmartDG_COMPHEIGHT - 4, "Out");
-			DG.DN[i].ShapeO->box(FL_BORDER_FRAME);
-			DG.DN[i].ShapeO->color(SmartDG_GUIDECOLOR);
-			DG.DN[i].ShapeO->align(FL_ALIGN_TOP);
+			Widgets[i].ShapeO->box(FL_BORDER_FRAME);
+			Widgets[i].ShapeO->color(SmartDG_GUIDECOLOR);
+			Widgets[i].ShapeO->align(FL_ALIGN_TOP);
 			unsigned int CursorO = nodey + 2;
-			for (unsigned int j = 0; j < DG.DN[i].DP[1].size(); j++) {
-				DG.DN[i].DP[1][j].Shape = new Fl_Group(
+			for (unsigned int j = 0; j < DG->DN[i].DP[1].size(); j++) {
+				Widgets[i].PortShape[1][j] = new Fl_Group(
 						nodex + SmartDG_COMPWIDTH - SmartDG_IX - SmartDG_IW,
 						CursorO, SmartDG_IW, SmartDG_IW,
-						DG.DN[i].DP[1][j].Name.c_str());
+						DG->DN[i].DP[1][j].Name.c_str());
 				unsigned int t;
 				if (SmartDG_COMPRESSFLAG)
 					t = CursorO + SmartDG_IW;
 				else
 					CursorO += SmartDG_IW;
-				DG.DN[i].DP[1][j].Shape->box(SmartDG_INOUTPORT_SHAPE);
-				DG.DN[i].DP[1][j].Shape->color(SmartDG_NODE_OUT_USE_COLOR);
-				DG.DN[i].DP[1][j].Shape->labelcolor(SmartDG_NODE_OUT_USE_COLOR);
-				DG.DN[i].DP[1][j].Shape->align(FL_ALIGN_RIGHT);
-				for (unsigned int l = 0; l < DG.DN[i].DP[1][j].DO.size(); l++) {
-					DG.DN[i].DP[1][j].DO[l].Shape = new Fl_Group(
+				Widgets[i].PortShape[1][j]->box(SmartDG_INOUTPORT_SHAPE);
+				Widgets[i].PortShape[1][j]->color(SmartDG_NODE_OUT_USE_COLOR);
+				Widgets[i].PortShape[1][j]->labelcolor(SmartDG_NODE_OUT_USE_COLOR);
+				Widgets[i].PortShape[1][j]->align(FL_ALIGN_RIGHT);
+				for (unsigned int l = 0; l < DG->DN[i].DP[1][j].DO.size(); l++) {
+					Widgets[i].ObjectShape[1][j][l] = new Fl_Group(
 							nodex + SmartDG_COMPWIDTH - SmartDG_IXX
 									- SmartDG_IWW, CursorO, SmartDG_IWW,
-							SmartDG_IWW, DG.DN[i].DP[1][j].DO[l].Name.c_str());
+							SmartDG_IWW, DG->DN[i].DP[1][j].DO[l].Name.c_str());
 					CursorO += SmartDG_IWW + 1;
-					DG.DN[i].DP[1][j].DO[l].Shape->box(
+					Widgets[i].ObjectShape[1][j][l]->box(
 					SmartDG_INOUTOBJECT_SHAPE);
 					if ((Mode == SmartDG_COMPONENT_MODE)
 							|| (Mode == SmartDG_COMPONENT_DEVELOPER_MODE)) {
-						DG.DN[i].DP[1][j].DO[l].Shape->color(
+						Widgets[i].ObjectShape[1][j][l]->color(
 						SmartDG_NODE_OUT_USE_COLOR);
-						DG.DN[i].DP[1][j].DO[l].Shape->labelcolor(
+						Widgets[i].ObjectShape[1][j][l]->labelcolor(
 						SmartDG_NODE_OUT_USE_COLOR);
 					}
-					DG.DN[i].DP[1][j].DO[l].Shape->align(FL_ALIGN_LEFT);
+					Widgets[i].ObjectShape[1][j][l]->align(FL_ALIGN_LEFT);
 				}
 				if (SmartDG_COMPRESSFLAG) {
 					if (CursorO <= t)
@@ -730,31 +756,31 @@ void DependencyMonitor::InitComponent() {
 			unsigned int CursorMax = max(CursorI, CursorO);
 			if ((CursorMax > SmartDG_COMPHEIGHT)
 					|| !(SmartDG_FIX_COMP_MIN_HEIGHT)) {
-				DG.DN[i].Shape->resize(nodex, nodey,
+				Widgets[i].Shape->resize(nodex, nodey,
 				SmartDG_COMPWIDTH, CursorMax - nodey + SmartDG_IW);
 				// Readjusts after Node Shape resize
-				DG.DN[i].ShapeI->resize(nodex + SmartDG_IX, nodey + 2,
+				Widgets[i].ShapeI->resize(nodex + SmartDG_IX, nodey + 2,
 				SmartDG_IW, CursorMax - nodey + SmartDG_IW - 4);
-				DG.DN[i].BarIn->resize(nodex, nodey,
+				Widgets[i].BarIn->resize(nodex, nodey,
 				SmartDG_NMENUWIDTH, SmartDG_NMENUHEIGHT);
-				if (DG.DN[i].DP[0].size() > 0)
-					DG.DN[i].DP[0][0].Shape->resize(nodex + SmartDG_IX,
+				if (DG->DN[i].DP[0].size() > 0)
+					Widgets[i].PortShape[0][0]->resize(nodex + SmartDG_IX,
 							nodey + 2,
 							SmartDG_IW, SmartDG_IW);
-				DG.DN[i].ShapeO->resize(
+				Widgets[i].ShapeO->resize(
 						nodex + SmartDG_COMPWIDTH - SmartDG_IX - SmartDG_IW,
 						nodey + 2,
 						SmartDG_IW, CursorMax - nodey + SmartDG_IW - 4);
-				DG.DN[i].BarOut->resize(
+				Widgets[i].BarOut->resize(
 						nodex + SmartDG_COMPWIDTH - SmartDG_NMENUWIDTH, nodey,
 						SmartDG_NMENUWIDTH, SmartDG_NMENUHEIGHT);
-				if (DG.DN[i].DP[1].size() > 0)
-					DG.DN[i].DP[1][0].Shape->resize(
+				if (DG->DN[i].DP[1].size() > 0)
+					Widgets[i].PortShape[1][0]->resize(
 							nodex + SmartDG_COMPWIDTH - SmartDG_IX - SmartDG_IW,
 							nodey + 2,
 							SmartDG_IW, SmartDG_IW);
 			}
-			DG.DN[i].Shape->end();
+			Widgets[i].Shape->end();
 		}
 	}
 	Generate_Dependency_Tabs();
@@ -774,6 +800,9 @@ void DependencyMonitor::Show(string displaymode) {
 		InitMT();
 		makelitejs();
 		SyncOutLiteInit();
+		// Serves the DGlite directory and the GlobalPackageLite deltas (LITE and DUAL display only)
+		if (!DGliteDir.empty())
+			DependencyLiteServer::Start(DGliteDir);
 		if (DisplayMode == SmartDG_DUAL_DISPLAYMODE)
 			MonitorWindow->show();
 		if (DisplayMode == SmartDG_LITE_DISPLAYMODE) {
@@ -794,6 +823,11 @@ void DependencyMonitor::MonitorWindowMenuBar_Callback() {
 	string Selection(sel);
 	if (SmartDG_MonitorWindowMenuBarVerbose)
 		cout << "MonitorWindowMenuBar: " + Selection << endl;
+	// Applies changes published by other Views
+	SyncPoll();
+	// Data changed by other Views sharing DG->Values breaks the local fixed point
+	if (DG->Values->version != SolverVersion)
+		SolverContext = "";
 	// Performs action according to selection for the following
 	// DGMonitor
 	if (Selection == "DGMonitor/Wiki") {
@@ -881,6 +915,16 @@ void DependencyMonitor::MonitorWindowMenuBar_Callback() {
 		SmartDG_SLEEP_BEFORE_PRINT_SCREEN_COMMAND));
 		system(SmartDG_PRINT_SCREEN_COMMAND);
 	}
+	if (Selection == "DGMonitor/Trace") {
+		if (SmartDG_MonitorWindowMenuBarVerbose)
+			cout << "Trace" << endl;
+		DependencyTrace::Dump(cout, DG.get());
+	}
+	if (Selection == "DGMonitor/Solver Stats") {
+		if (SmartDG_MonitorWindowMenuBarVerbose)
+			cout << "Solver Stats" << endl;
+		cout << SolverStats.JSON(DG.get()) << endl;
+	}
 	if (Selection == "DGMonitor/Sync/Allow") {
 		if (SmartDG_MonitorWindowMenuBarVerbose)
 			cout << "DGMonitor/Sync/Allow" << endl;
@@ -944,53 +988,26 @@ void DependencyMonitor::MonitorWindowMenuBar_Callback() {
 					<< SmartDG_GlobalData::GlobalDebug["Debug"] << endl;
 			tmpval = true;
 			SmartDG_GlobalData::GlobalDebug["Debug"].Set(true);
-			for (unsigned int n = 0; n < DG.DN.size(); n++) {
-				for (unsigned int io = 0; io < DG.DN[n].DP.size(); io++) {
-					for (unsigned int p = 0; p < DG.DN[n].DP[io].size(); p++) {
-						for (unsigned int o = 0;
-								o < DG.DN[n].DP[io][p].DO.size(); o++) {
-							for (map<string, DependencyDataPackage>::const_iterator it =
-									DG.DN[n].DP[io][p].DO[o].udi.begin();
-									it != DG.DN[n].DP[io][p].DO[o].udi.end();
-									++it) {
-								DG.DN[n].DP[io][p].DO[o].udi[it->first].Set(
-										tmpval);
-							}
-						}
-					}
-				}
-			}
+			DG->Values->Fill(tmpval);
 			cout << "Debug: GlobalDebug[Debug] is "
 					<< SmartDG_GlobalData::GlobalDebug["Debug"] << endl;
+			SolverContext = "";
 		}
 		if (Selection == "Debug/ToggleAll/False") {
 			cout << "Debug: GlobalDebug[Debug] was "
 					<< SmartDG_GlobalData::GlobalDebug["Debug"] << endl;
 			tmpval = false;
 			SmartDG_GlobalData::GlobalDebug["Debug"].Set(false);
-			for (unsigned int n = 0; n < DG.DN.size(); n++) {
-				for (unsigned int io = 0; io < DG.DN[n].DP.size(); io++) {
-					for (unsigned int p = 0; p < DG.DN[n].DP[io].size(); p++) {
-						for (unsigned int o = 0;
-								o < DG.DN[n].DP[io][p].DO.size(); o++) {
-							for (map<string, DependencyDataPackage>::const_iterator it =
-									DG.DN[n].DP[io][p].DO[o].udi.begin();
-									it != DG.DN[n].DP[io][p].DO[o].udi.end();
-									++it) {
-								DG.DN[n].DP[io][p].DO[o].udi[it->first].Set(
-										tmpval);
-							}
-						}
-					}
-				}
-			}
+			DG->Values->Fill(tmpval);
 			cout << "Debug: GlobalDebug[Debug] is "
 					<< SmartDG_GlobalData::GlobalDebug["Debug"] << endl;
+			SolverContext = "";
 		}
 		if (Selection == "Debug/ToggleAll/SyncOut") {
 			SyncOut();
 		}
 		if (Selection == "Debug/ToggleAll/SyncIn") {
+			SyncVersion = 0;
 			SyncIn();
 		}
 		RefreshMonitorData(currentView);
@@ -1014,104 +1031,8 @@ void DependencyMonitor::MonitorWindowMenuBar_Callback() {
 		MenuJointRefresh();
 		RefreshMonitorData(currentView);
 	}
-	// Edit
-	if (Mode == SmartDG_OBJECT_MODE) {
-		resetConDirection();
-		for (unsigned int i = 0; i < DG.DOI.I.size(); i++) {
-			if (DG.DOI.I[i].obj == currentView) {
-				DependencyDataPackage d;
-				if (Selection == "Edit/" + DG.DOI.I[i].amidL + "/true") {
-					URL f = DG.DOI.I[i].pou;
-					URL t = DG.DOI.I[i].tou;
-					d.Set(true);
-					DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].Set(
-							d);
-					Solver(i);
-					RefreshMonitorData(currentView);
-				}
-				if (Selection == "Edit/" + DG.DOI.I[i].amidL + "/false") {
-					URL f = DG.DOI.I[i].pou;
-					URL t = DG.DOI.I[i].tou;
-					d.Set(false);
-					DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].Set(
-							d);
-					Solver(i);
-					RefreshMonitorData(currentView);
-				}
-			}
-		}
-		for (unsigned int i = 0; i < DG.DOI.I.size(); i++) {
-			if (DG.DOI.I[i].obj == currentView) {
-				if (Selection == "Edit/" + DG.DOI.I[i].midL + "/true") {
-					URL f = DG.DOI.I[i].pou;
-					URL t = DG.DOI.I[i].tou;
-					DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].udi[t.str].Set(
-							true);
-					resetConDirection();
-					Solver(i);
-					RefreshMonitorData(currentView);
-				}
-				if (Selection == "Edit/" + DG.DOI.I[i].midL + "/false") {
-					URL f = DG.DOI.I[i].pou;
-					URL t = DG.DOI.I[i].tou;
-					DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].udi[t.str].Set(
-							false);
-					resetConDirection();
-					Solver(i);
-					RefreshMonitorData(currentView);
-				}
-			}
-		}
-	}
-	if ((Mode == SmartDG_COMPONENT_MODE)
-			|| (Mode == SmartDG_COMPONENT_DEVELOPER_MODE)) {
-		resetConDirection();
-		for (unsigned int i = 0; i < DG.DOI.I.size(); i++) {
-			if (DG.DOI.I[i].pou.strn == currentComponent) {
-				DependencyDataPackage d;
-				if (Selection == "Edit/" + DG.DOI.I[i].amidL + "/true") {
-					URL f = DG.DOI.I[i].pou;
-					URL t = DG.DOI.I[i].tou;
-					d.Set(true);
-					DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].Set(
-							d);
-					Solver(i);
-					RefreshMonitorData(currentView);
-				}
-				if (Selection == "Edit/" + DG.DOI.I[i].amidL + "/false") {
-					URL f = DG.DOI.I[i].pou;
-					URL t = DG.DOI.I[i].tou;
-					d.Set(false);
-					DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].Set(
-							d);
-					Solver(i);
-					RefreshMonitorData(currentView);
-				}
-			}
-		}
-		for (unsigned int i = 0; i < DG.DOI.I.size(); i++) {
-			if (DG.DOI.I[i].pou.strn == currentComponent) {
-				if (Selection == "Edit/" + DG.DOI.I[i].midL + "/true") {
-					URL f = DG.DOI.I[i].pou;
-					URL t = DG.DOI.I[i].tou;
-					DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].udi[t.str].Set(
-							true);
-					resetConDirection();
-					Solver(i);
-					RefreshMonitorData(currentView);
-				}
-				if (Selection == "Edit/" + DG.DOI.I[i].midL + "/false") {
-					URL f = DG.DOI.I[i].pou;
-					URL t = DG.DOI.I[i].tou;
-					DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].udi[t.str].Set(
-							false);
-					resetConDirection();
-					Solver(i);
-					RefreshMonitorData(currentView);
-				}
-			}
-		}
-	}
+	// Clears Connection directions shown for the last edit
+	resetConDirection();
 	// Sync
 	if (Selection == "Sync/Refresh") { //#TODO Auto Refresh
 		if (SmartDG_MonitorWindowMenuBarVerbose)
@@ -1172,6 +1093,7 @@ void DependencyMonitor::MonitorWindowMenuBar_Callback() {
 	if (Selection == "Sync/⟱ Download") {
 		if (SmartDG_MonitorWindowMenuBarVerbose)
 			cout << "Sync/⟱ Download" << endl;
+		SyncVersion = 0;
 		SyncIn();
 		GenDispStr();
 		MonitorWindowScroll->label(DispString.c_str());
@@ -1227,209 +1149,43 @@ void DependencyMonitor::MTWindowMenuBar_Callback() {
 	}
 }
 
-void DependencyMonitor::NodeMenuBar_Callback() {
-	for (unsigned int tog = 0; tog <= 1; tog++) { // tog is toggle between Input and Output NodeMenuBar
-		for (unsigned int i = 0; i < DG.DN.size(); i++) {
-			// Identifies selected option from the DependencyNode::BarIn and DependencyNode::BarOut menu bars
-			char sel[1000];
-			string label = "";
-			string Selection = "";
-			if (0 == tog) {
-				if (DG.DN[i].BarIn) {
-					DG.DN[i].BarIn->item_pathname(sel, sizeof(sel) - 1);
-					label = DG.DN[i].BarIn->label();
-					Selection = string(sel);
-					if (Selection != "")
-						DG.DN[i].BarIn->value(0);
-				}
-			} else {
-				if (DG.DN[i].BarOut) {
-					DG.DN[i].BarOut->item_pathname(sel, sizeof(sel) - 1);
-					label = DG.DN[i].BarOut->label();
-					Selection = string(sel);
-					if (Selection != "")
-						DG.DN[i].BarOut->value(0);
-				}
-			}
-			if (Selection == "✎")
-				Selection = "";
-			if (Selection != "") {
-				// Edit DependencyObject object's all or specific instance as true/false
-				string portname = extractPortName(Selection);
-				if (label == DG.DN[i].Name) {
-					if (Mode == SmartDG_OBJECT_MODE) {
-						resetConDirection();
-						for (unsigned int j = 0; j < DG.DOI.I.size(); j++) {
-							if ((DG.DOI.I[j].pou.strn == DG.DN[i].Name)
-									&& (DG.DOI.I[j].pou.strio == tog2str(tog))
-									&& (DG.DOI.I[j].pou.strp == portname)
-									&& (DG.DOI.I[j].pou.stro == currentView)
-									&& (DG.DOI.I[j].direction
-											== currentDirection)) {
-								URL f = DG.DOI.I[j].pou;
-								URL t = DG.DOI.I[j].tou;
-								DependencyDataPackage d;
-								if (Selection
-										== string(
-												"✎/" + DG.DOI.I[j].amid
-														+ "/true")) {
-									if (SmartDG_NodeMenuBarVerbose)
-										cout << DG.DN[i].Name
-												<< " NodeMenuBar: " + Selection
-												<< endl;
-									d.Set(true);
-									DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].Set(
-											d);
-									Solver(j);
-									RefreshMonitorData(currentView);
-								}
-								if (Selection
-										== string(
-												"✎/" + DG.DOI.I[j].amid
-														+ "/false")) {
-									if (SmartDG_NodeMenuBarVerbose)
-										cout << DG.DN[i].Name
-												<< " NodeMenuBar: " + Selection
-												<< endl;
-									d.Set(false);
-									DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].Set(
-											d);
-									Solver(j);
-									RefreshMonitorData(currentView);
-								}
-							}
-						}
-						for (unsigned int j = 0; j < DG.DOI.I.size(); j++) {
-							if ((DG.DOI.I[j].pou.strn == DG.DN[i].Name)
-									&& (DG.DOI.I[j].pou.strio == tog2str(tog))
-									&& (DG.DOI.I[j].pou.strp == portname)
-									&& (DG.DOI.I[j].pou.stro == currentView)
-									&& (DG.DOI.I[j].direction
-											== currentDirection)) {
-								URL f = DG.DOI.I[j].pou;
-								URL t = DG.DOI.I[j].tou;
-								if (Selection
-										== string(
-												"✎/" + DG.DOI.I[j].mid
-														+ "/true")) {
-									if (SmartDG_NodeMenuBarVerbose)
-										cout << DG.DN[i].Name
-												<< " NodeMenuBar: " + Selection
-												<< endl;
-									DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].udi[t.str].Set(
-											true);
-									resetConDirection();
-									Solver(j);
-									RefreshMonitorData(currentView);
-									break;
-								}
-								if (Selection
-										== string(
-												"✎/" + DG.DOI.I[j].mid
-														+ "/false")) {
-									if (SmartDG_NodeMenuBarVerbose)
-										cout << DG.DN[i].Name
-												<< " NodeMenuBar: " + Selection
-												<< endl;
-									DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].udi[t.str].Set(
-											false);
-									resetConDirection();
-									Solver(j);
-									RefreshMonitorData(currentView);
-									break;
-								}
-							}
-						}
-					}
-					if ((Mode == SmartDG_COMPONENT_MODE)
-							|| (Mode == SmartDG_COMPONENT_DEVELOPER_MODE)) {
-						resetConDirection();
-						for (unsigned int j = 0; j < DG.DOI.I.size(); j++) {
-							if ((DG.DOI.I[j].pou.strn == DG.DN[i].Name)
-									&& (DG.DOI.I[j].pou.strio == tog2str(tog))
-									&& (DG.DOI.I[j].pou.strp == portname)
-									&& (DG.DOI.I[j].pou.strn == currentComponent)
-									&& (DG.DOI.I[j].direction
-											== currentDirection)) {
-								URL f = DG.DOI.I[j].pou;
-								URL t = DG.DOI.I[j].tou;
-								DependencyDataPackage d;
-								if (Selection
-										== string(
-												"✎/" + DG.DOI.I[j].amid
-														+ "/true")) {
-									if (SmartDG_NodeMenuBarVerbose)
-										cout << DG.DN[i].Name
-												<< " NodeMenuBar: " + Selection
-												<< endl;
-									d.Set(true);
-									DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].Set(
-											d);
-									Solver(j);
-									RefreshMonitorData(currentView);
-								}
-								if (Selection
-										== string(
-												"✎/" + DG.DOI.I[j].amid
-														+ "/false")) {
-									if (SmartDG_NodeMenuBarVerbose)
-										cout << DG.DN[i].Name
-												<< " NodeMenuBar: " + Selection
-												<< endl;
-									d.Set(false);
-									DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].Set(
-											d);
-									Solver(j);
-									RefreshMonitorData(currentView);
-								}
-							}
-						}
-						for (unsigned int j = 0; j < DG.DOI.I.size(); j++) {
-							if ((DG.DOI.I[j].pou.strn == DG.DN[i].Name)
-									&& (DG.DOI.I[j].pou.strio == tog2str(tog))
-									&& (DG.DOI.I[j].pou.strp == portname)
-									&& (DG.DOI.I[j].pou.strn == currentComponent)
-									&& (DG.DOI.I[j].direction
-											== currentDirection)) {
-								URL f = DG.DOI.I[j].pou;
-								URL t = DG.DOI.I[j].tou;
-								if (Selection
-										== string(
-												"✎/" + DG.DOI.I[j].mid
-														+ "/true")) {
-									if (SmartDG_NodeMenuBarVerbose)
-										cout << DG.DN[i].Name
-												<< " NodeMenuBar: " + Selection
-												<< endl;
-									DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].udi[t.str].Set(
-											true);
-									resetConDirection();
-									Solver(j);
-									RefreshMonitorData(currentView);
-									break;
-								}
-								if (Selection
-										== string(
-												"✎/" + DG.DOI.I[j].mid
-														+ "/false")) {
-									if (SmartDG_NodeMenuBarVerbose)
-										cout << DG.DN[i].Name
-												<< " NodeMenuBar: " + Selection
-												<< endl;
-									DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].udi[t.str].Set(
-											false);
-									resetConDirection();
-									Solver(j);
-									RefreshMonitorData(currentView);
-									break;
-								}
-							}
-						}
-					}
-				}
-			}
-		}
-	}
+void DependencyMonitor::EditMenuBar_Callback(const DependencyMenuHandle &h) {
+	DependencyObjectInstance &oi = DG->DOI.I[h.doiindex];
+	if (SmartDG_MonitorWindowMenuBarVerbose)
+		cout << "MonitorWindowMenuBar: Edit/" << (h.all ? oi.amidL : oi.midL)
+				<< "/" << (h.value ? "true" : "false") << endl;
+	// Edit DependencyObject object's all or specific instance as true/false (a batch of one)
+	BeginEdits();
+	SetEdit(h.doiindex, h.value, h.all);
+	CommitEdits();
+}
+
+void DependencyMonitor::NodeMenuBar_Callback(const DependencyMenuHandle &h) {
+	DependencyObjectInstance &oi = DG->DOI.I[h.doiindex];
+	// Only instances of the current View (or Component) in the current Business direction are editable
+	if (oi.direction != currentDirection)
+		return;
+	if ((Mode == SmartDG_OBJECT_MODE) && (oi.pou.stro() != currentView))
+		return;
+	if (((Mode == SmartDG_COMPONENT_MODE)
+			|| (Mode == SmartDG_COMPONENT_DEVELOPER_MODE))
+			&& (oi.pou.strn() != currentComponent))
+		return;
+	if (SmartDG_NodeMenuBarVerbose)
+		cout << oi.pou.strn() << " NodeMenuBar: ✎/"
+				<< (h.all ? oi.amid : oi.mid) << "/"
+				<< (h.value ? "true" : "false") << endl;
+	// Edit DependencyObject object's all or specific instance as true/false (a batch of one)
+	BeginEdits();
+	SetEdit(h.doiindex, h.value, h.all);
+	CommitEdits();
+}
+
+DependencyMenuHandle *DependencyMonitor::MenuHandle(unsigned int doiindex,
+		bool all, bool value) {
+	// deque keeps addresses stable as handles are added
+	MenuHandles.push_back(DependencyMenuHandle(this, doiindex, all, value));
+	return &MenuHandles.back();
 }
 
 void DependencyMonitor::setup() {
@@ -1465,6 +1221,13 @@ void DependencyMonitor::setup() {
 	// Sets default values for View2ViewFlag and SolverSync (Sync action flags)
 	View2ViewFlag = SmartDG_View2ViewFlag_DEFAULT_VALUE;
 	SolverSync = SmartDG_SolverSync_DEFAULT_VALUE;
+	// DependencyGraph data is not known to be at a fixed point yet
+	SolverContext = "";
+	SolverVersion = 0;
+	EditsOpen = false;
+	SyncSubscriber = DependencySyncBus::Subscribe();
+	LiteSynced = false;
+	SyncVersion = 0;
 
 	if (Mode != SmartDG_COMPONENT_DEVELOPER_MODE)
 		if (!DependencyMonitor::MTLiteInit) {
@@ -1472,11 +1235,9 @@ void DependencyMonitor::setup() {
 
 			DGliteDir = string(SmartDG_LiteFolderLocation) + string("/")
 					+ string(SmartDG_LiteFoldername);
-			std::system(string("mkdir -p " + DGliteDir).c_str());
+			DependencyLiteWriter::MakeDirectory(DGliteDir);
 
-			ofstream htmlfile;
-			htmlfile.open(DGliteDir + "/" + MTWindowTitle + ".html",
-					ios::trunc);
+			ostringstream htmlfile;
 			htmlfile << "<!--------------------------------------------------\n"
 					<< SmartDG_WIKI << endl;
 			htmlfile
@@ -1504,13 +1265,14 @@ void DependencyMonitor::setup() {
 			htmlfile << "<script src=\"" << MTWindowTitle << ".js\"></script>"
 					<< endl;
 			htmlfile << "<script src=\"Looper.js\"></script>" << endl;
-			htmlfile << "<script> LooperDG(1000); </script>" << endl;
+			htmlfile << "<script> LooperDG(" << SmartDG_SLEEP_BETWEEN_SYNLITE
+					<< "); </script>" << endl;
 			htmlfile << "</body>" << endl;
 			htmlfile << "</html>" << endl;
-			htmlfile.close();
+			DependencyLiteWriter::Write(DGliteDir + "/" + MTWindowTitle + ".html",
+					htmlfile.str());
 
-			ofstream jsfile1;
-			jsfile1.open(DGliteDir + "/Looper.js", ios::trunc);
+			ostringstream jsfile1;
 			jsfile1 << "/*****************************************\n"
 					<< SmartDG_WIKI << endl;
 			jsfile1
@@ -1519,25 +1281,19 @@ void DependencyMonitor::setup() {
 			jsfile1
 					<< "function LooperDG (i) {	setTimeout(function () { ViewDG(); LooperDG(i);	}, i); }"
 					<< endl;
-			jsfile1.close();
+			DependencyLiteWriter::Write(DGliteDir + "/Looper.js",
+					jsfile1.str());
 
-			ofstream jsfile2;
-			jsfile2.open(DGliteDir + "/" + MTWindowTitle + ".js", ios::trunc);
+			ostringstream jsfile2;
 			jsfile2 << "/*****************************************\n"
 					<< SmartDG_WIKI << endl;
 			jsfile2
 					<< "SmartDGlite Auto Generated \n*****************************************/"
 					<< endl;
-			jsfile2.close();
+			DependencyLiteWriter::Write(DGliteDir + "/" + MTWindowTitle + ".js",
+					jsfile2.str());
 
-			ofstream jsonfile;
-			jsonfile.open(DGliteDir + "/" + MTWindowTitle + ".json",
-					ios::trunc);
-			jsonfile << "var dgdata = []" << endl;
-			jsonfile.close();
-
-			ofstream stylefile;
-			stylefile.open(DGliteDir + "/style.css", ios::trunc);
+			ostringstream stylefile;
 			stylefile
 					<< "SmartDGlite Auto Generated \n*****************************************/"
 					<< endl;
@@ -1547,13 +1303,15 @@ void DependencyMonitor::setup() {
 			stylefile
 					<< "#cy { height: 100%; width: 100%; position: absolute; left: 0; top: 0; }"
 					<< endl;
-			stylefile.close();
+			DependencyLiteWriter::Write(DGliteDir + "/style.css",
+					stylefile.str());
 		}
 }
 
 void DependencyMonitor::makelitejs() {
 	// Creates Java Script file in DGlite directory  (In all except DependencyMonitor::Mode : SmartDG_COMPONENT_DEVELOPER_MODE)
-	if (Mode == SmartDG_COMPONENT_DEVELOPER_MODE)
+	// DGlite directory is owned by the DependencyMonitor that created it
+	if ((Mode == SmartDG_COMPONENT_DEVELOPER_MODE) || DGliteDir.empty())
 		return;
 	map<unsigned int, unsigned int> gx;
 	map<unsigned int, unsigned int> gy;
@@ -1569,18 +1327,18 @@ void DependencyMonitor::makelitejs() {
 	unsigned int Lprevy = 0;
 	unsigned int Rprevy = 0;
 	unsigned int Mprevy = 0;
-	unsigned int nsz = DG.DN.size();
+	unsigned int nsz = DG->DN.size();
 	if (nsz > 3) {
 		numcolsx = nsz;
 		if (nsz % 2 == 0)
 			numcolsx = nsz + 1;
 	}
-	for (unsigned int i = 0; i < DG.DN.size(); i++) {
+	for (unsigned int i = 0; i < DG->DN.size(); i++) {
 		unsigned int Lnumobji = 0;
-		if (DG.DN[i].DP[0].size() == 0) {
-			for (unsigned int j = 0; j < DG.DN[i].DP[1].size(); j++) {
-				for (unsigned int k = 0; k < DG.DN[i].DP[1][j].DO.size(); k++) {
-					Lnumobji += DG.DN[i].DP[1][j].DO[k].udi.size();
+		if (DG->DN[i].DP[0].size() == 0) {
+			for (unsigned int j = 0; j < DG->DN[i].DP[1].size(); j++) {
+				for (unsigned int k = 0; k < DG->DN[i].DP[1][j].DO.size(); k++) {
+					Lnumobji += DG->DN[i].DP[1][j].DO[k].Instances();
 				}
 			}
 			unsigned int Lsz = Lnodes.size();
@@ -1595,10 +1353,10 @@ void DependencyMonitor::makelitejs() {
 			continue;
 		}
 		unsigned int Rnumobji = 0;
-		if (DG.DN[i].DP[1].size() == 0) {
-			for (unsigned int j = 0; j < DG.DN[i].DP[0].size(); j++) {
-				for (unsigned int k = 0; k < DG.DN[i].DP[0][j].DO.size(); k++) {
-					Rnumobji += DG.DN[i].DP[0][j].DO[k].udi.size();
+		if (DG->DN[i].DP[1].size() == 0) {
+			for (unsigned int j = 0; j < DG->DN[i].DP[0].size(); j++) {
+				for (unsigned int k = 0; k < DG->DN[i].DP[0][j].DO.size(); k++) {
+					Rnumobji += DG->DN[i].DP[0][j].DO[k].Instances();
 				}
 			}
 			unsigned int Rsz = Rnodes.size();
@@ -1613,14 +1371,14 @@ void DependencyMonitor::makelitejs() {
 			continue;
 		}
 		unsigned int Mnumobji = 0;
-		for (unsigned int j = 0; j < DG.DN[i].DP[1].size(); j++) {
-			for (unsigned int k = 0; k < DG.DN[i].DP[1][j].DO.size(); k++) {
-				Mnumobji += DG.DN[i].DP[1][j].DO[k].udi.size();
+		for (unsigned int j = 0; j < DG->DN[i].DP[1].size(); j++) {
+			for (unsigned int k = 0; k < DG->DN[i].DP[1][j].DO.size(); k++) {
+				Mnumobji += DG->DN[i].DP[1][j].DO[k].Instances();
 			}
 		}
-		for (unsigned int j = 0; j < DG.DN[i].DP[0].size(); j++) {
-			for (unsigned int k = 0; k < DG.DN[i].DP[0][j].DO.size(); k++) {
-				Mnumobji += DG.DN[i].DP[0][j].DO[k].udi.size();
+		for (unsigned int j = 0; j < DG->DN[i].DP[0].size(); j++) {
+			for (unsigned int k = 0; k < DG->DN[i].DP[0][j].DO.size(); k++) {
+				Mnumobji += DG->DN[i].DP[0][j].DO[k].Instances();
 			}
 		}
 		unsigned int Msz = Mnodes.size();
@@ -1633,8 +1391,7 @@ void DependencyMonitor::makelitejs() {
 		}
 		Mnodes.push_back(i);
 	}
-	ofstream jsfile;
-	jsfile.open(DGliteDir + "/" + MTWindowTitle + ".js", ios::trunc);
+	ostringstream jsfile;
 	jsfile << "/*****************************************\n" << SmartDG_WIKI
 			<< endl;
 	jsfile
@@ -1692,20 +1449,20 @@ void DependencyMonitor::makelitejs() {
 	jsfile
 			<< "      { data: { id: 'BLINKY' , LAB: 'Live', True: 0, False: 0   },"
 			<< " position: { x: 50, y: 50 } }," << endl;
-	for (unsigned int i = 0; i < DG.DN.size(); i++) {
-		string n = DG.DN[i].Name;
-		string nl = "Node " + DG.DN[i].Name;
+	for (unsigned int i = 0; i < DG->DN.size(); i++) {
+		string n = DG->DN[i].Name;
+		string nl = "Node " + DG->DN[i].Name;
 		jsfile << "      { data: { id: '" << n << "' , LAB: '" << nl << "' } },"
 				<< endl;
 		unsigned int coi = 0;
-		for (unsigned int j = 0; j < DG.DN[i].DP[0].size(); j++) {
-			string p = n + "xInx" + DG.DN[i].DP[0][j].Name;
-			string pl = "Port " + DG.DN[i].DP[0][j].Name;
+		for (unsigned int j = 0; j < DG->DN[i].DP[0].size(); j++) {
+			string p = n + "xInx" + DG->DN[i].DP[0][j].Name;
+			string pl = "Port " + DG->DN[i].DP[0][j].Name;
 			jsfile << "      { data: { id: '" << p << "', LAB: '" << pl
 					<< "', parent: '" << n << "' } }," << endl;
-			for (unsigned int k = 0; k < DG.DN[i].DP[0][j].DO.size(); k++) {
-				string o = p + "x" + DG.DN[i].DP[0][j].DO[k].Name;
-				string ol = "Object " + DG.DN[i].DP[0][j].DO[k].Name;
+			for (unsigned int k = 0; k < DG->DN[i].DP[0][j].DO.size(); k++) {
+				string o = p + "x" + DG->DN[i].DP[0][j].DO[k].Name;
+				string ol = "Object " + DG->DN[i].DP[0][j].DO[k].Name;
 				jsfile << "      { data: { id: '" << o << "', LAB: '" << ol
 						<< "', parent: '" << p << "' } }," << endl;
 				string oi = o + "xAllx";
@@ -1715,13 +1472,13 @@ void DependencyMonitor::makelitejs() {
 						<< "', parent: '" << o << "', True: 0, False: 0  }"
 						<< ", position: { x: " << gx[i] << ", y: "
 						<< gy[i] + (coi * spaceobjiy) << " }" << " }," << endl;
-				for (map<string, DependencyDataPackage>::const_iterator it =
-						DG.DN[i].DP[0][j].DO[k].udi.begin();
-						it != DG.DN[i].DP[0][j].DO[k].udi.end(); ++it) {
-					string dotless = it->first;
+				for (unsigned int u = 0; u < DG->DN[i].DP[0][j].DO[k].Instances();
+						u++) {
+					string key = DG->DN[i].DP[0][j].DO[k].udk[u];
+					string dotless = key;
 					replace(dotless.begin(), dotless.end(), '.', 'x');
 					string oi = o + "x" + dotless + "x";
-					string oil = "From " + it->first;
+					string oil = "From " + key;
 					coi++;
 					jsfile << "      { data: { id: '" << oi << "', LAB: '"
 							<< oil << "', parent: '" << o
@@ -1732,14 +1489,14 @@ void DependencyMonitor::makelitejs() {
 			}
 		}
 		coi = 0;
-		for (unsigned int j = 0; j < DG.DN[i].DP[1].size(); j++) {
-			string p = n + "xOutx" + DG.DN[i].DP[1][j].Name;
-			string pl = "Port " + DG.DN[i].DP[1][j].Name;
+		for (unsigned int j = 0; j < DG->DN[i].DP[1].size(); j++) {
+			string p = n + "xOutx" + DG->DN[i].DP[1][j].Name;
+			string pl = "Port " + DG->DN[i].DP[1][j].Name;
 			jsfile << "      { data: { id: '" << p << "', LAB: '" << pl
 					<< "', parent: '" << n << "' } }," << endl;
-			for (unsigned int k = 0; k < DG.DN[i].DP[1][j].DO.size(); k++) {
-				string o = p + "x" + DG.DN[i].DP[1][j].DO[k].Name;
-				string ol = "Object " + DG.DN[i].DP[1][j].DO[k].Name;
+			for (unsigned int k = 0; k < DG->DN[i].DP[1][j].DO.size(); k++) {
+				string o = p + "x" + DG->DN[i].DP[1][j].DO[k].Name;
+				string ol = "Object " + DG->DN[i].DP[1][j].DO[k].Name;
 				jsfile << "      { data: { id: '" << o << "', LAB: '" << ol
 						<< "', parent: '" << p << "' } }," << endl;
 				string oi = o + "xAllx";
@@ -1749,13 +1506,13 @@ void DependencyMonitor::makelitejs() {
 						<< "', parent: '" << o << "', True: 0, False: 0  }"
 						<< ", position: { x: " << gx[i] + spacenodex << ", y: "
 						<< gy[i] + (coi * spaceobjiy) << " }" << " }," << endl;
-				for (map<string, DependencyDataPackage>::const_iterator it =
-						DG.DN[i].DP[1][j].DO[k].udi.begin();
-						it != DG.DN[i].DP[1][j].DO[k].udi.end(); ++it) {
-					string dotless = it->first;
+				for (unsigned int u = 0; u < DG->DN[i].DP[1][j].DO[k].Instances();
+						u++) {
+					string key = DG->DN[i].DP[1][j].DO[k].udk[u];
+					string dotless = key;
 					replace(dotless.begin(), dotless.end(), '.', 'x');
 					string oi = o + "x" + dotless + "x";
-					string oil = "To " + it->first;
+					string oil = "To " + key;
 					coi++;
 					jsfile << "      { data: { id: '" << oi << "', LAB: '"
 							<< oil << "', parent: '" << o
@@ -1770,16 +1527,16 @@ void DependencyMonitor::makelitejs() {
 	jsfile << "    ]," << endl;
 	jsfile << "" << endl;
 	jsfile << "    edges: [" << endl;
-	for (unsigned int objs = 0; objs < DG.dobjs.size(); objs++) {
-		string obj = DG.dobjs[objs];
-		for (unsigned int dep = 0; dep < DG.View[obj].size(); dep++) {
-			string id = DG.View[obj][dep].From.dotless() + "xxx"
-					+ DG.View[obj][dep].To.dotless();
-			string lab = DG.View[obj][dep].Name;
-			string source = DG.View[obj][dep].From.dotless() + "x"
-					+ DG.View[obj][dep].To.dotless() + "x";
-			string target = DG.View[obj][dep].To.dotless() + "x"
-					+ DG.View[obj][dep].From.dotless() + "x";
+	for (unsigned int objs = 0; objs < DG->dobjs.size(); objs++) {
+		string obj = DG->dobjs[objs];
+		for (unsigned int dep = 0; dep < DG->View[obj].size(); dep++) {
+			string id = DG->View[obj][dep].From.dotless() + "xxx"
+					+ DG->View[obj][dep].To.dotless();
+			string lab = DG->View[obj][dep].Name;
+			string source = DG->View[obj][dep].From.dotless() + "x"
+					+ DG->View[obj][dep].To.dotless() + "x";
+			string target = DG->View[obj][dep].To.dotless() + "x"
+					+ DG->View[obj][dep].From.dotless() + "x";
 			jsfile << "      { data: { id: '" << id << "', LAB: '" << lab
 					<< "', weight: 1, source: '" << source << "', target: '"
 					<< target << "' } }," << endl;
@@ -1798,10 +1555,8 @@ void DependencyMonitor::makelitejs() {
 	jsfile << "  }" << endl;
 	jsfile << "});" << endl;
 	jsfile << "" << endl;
-	jsfile << "function ViewDG(){" << endl;
-	jsfile
-			<< "  $.getScript( \"http://localhost:3000/DGlite.json\", function( data, textStatus, jqxhr ) {"
-			<< endl;
+	jsfile << "// Applies {id, val} entries to the graph" << endl;
+	jsfile << "function ApplyDG(dgdata){" << endl;
 	jsfile << "  for(var i=0; i< dgdata.length; i++){" << endl;
 	jsfile
 			<< "    if(dgdata[i].val == \"NA\")     {  cy.$(dgdata[i].id).data('False', 0); cy.$(dgdata[i].id).data('True', 0); }"
@@ -1812,13 +1567,30 @@ void DependencyMonitor::makelitejs() {
 	jsfile
 			<< "    else if(dgdata[i].val == \"F\"){  cy.$(dgdata[i].id).data('False', 10); cy.$(dgdata[i].id).data('True', 0); }"
 			<< endl;
+	jsfile
+			<< "    else if(dgdata[i].val.charAt(1) == \":\"){  var t = (dgdata[i].val.charAt(0) == \"T\") ? 10 : 0; cy.$(dgdata[i].id).data('False', 10-t); cy.$(dgdata[i].id).data('True', t); }"
+			<< endl;
 	jsfile
 			<< "    else {  cy.$(dgdata[i].id).data('False', 10-dgdata[i].val); cy.$(dgdata[i].id).data('True', 1+dgdata[i].val-1); }"
 			<< endl;
-	jsfile << "  }	" << endl;
+	jsfile << "  }" << endl;
+	jsfile << "}" << endl;
+	jsfile
+			<< "// Asks the DGlite server for the entries changed since the version last applied"
+			<< endl;
+	jsfile << "var dglite = { gen: 0, v: 0 };" << endl;
+	jsfile << "function ViewDG(){" << endl;
+	jsfile << "  $.ajax({ url: \"http://localhost:" << SmartDG_LITE_SERVER_PORT
+			<< "/" << SmartDG_BaseLite
+			<< ".delta?g=\" + dglite.gen + \"&v=\" + dglite.v, dataType: \"json\", cache: false,"
+			<< endl;
+	jsfile
+			<< "    success: function( delta, textStatus, jqxhr ) { dglite.gen = delta.g; dglite.v = delta.v; ApplyDG(delta.d); }"
+			<< endl;
 	jsfile << "  });" << endl;
 	jsfile << "}" << endl;
-	jsfile.close();
+	DependencyLiteWriter::Write(DGliteDir + "/" + MTWindowTitle + ".js",
+			jsfile.str());
 }
 
 void DependencyMonitor::InitMT() {
@@ -1839,21 +1611,81 @@ void DependencyMonitor::InitMT() {
 			Static_MTWindowMenuBar_Callback, (void*) this);
 }
 
-void DependencyMonitor::SyncOI() {
+void DependencyMonitor::SyncOI(const vector<unsigned int> &doiindices) {
 	if (View2ViewFlag && SmartDG_GlobalData::View2ViewFlag) {
-		SyncOut();
+		vector<unsigned int> ids = SyncIds(doiindices);
+		SyncPublish(ids);
 		if (DisplayMode != SmartDG_FLTK_DISPLAYMODE) {
-			SyncOutLite(true);
+			// All udi once (replacing the SyncOutLiteInit() placeholders), changed udi after that
+			if (LiteSynced)
+				SyncOutLite(ids, true);
+			else
+				SyncOutLite(true);
+			LiteSynced = true;
 		}
-		std::this_thread::sleep_for(std::chrono::milliseconds(
-		SmartDG_SLEEP_BETWEEN_SYNCOUT_SYNCIN));
+	}
+}
+
+vector<unsigned int> DependencyMonitor::SyncIds(
+		const vector<unsigned int> &doiindices) {
+	// Value ids changed by the last solve, the edited udi and all udi of the edited DependencyObjects
+	vector<unsigned int> ids = DG->Changes.ids;
+	for (unsigned int k = 0; k < doiindices.size(); k++) {
+		ids.push_back(DG->DOI.I[doiindices[k]].vid);
+		URL f = DG->DOI.I[doiindices[k]].pou;
+		DependencyObject &o =
+				DG->DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex];
+		ids.insert(ids.end(), o.udv.begin(), o.udv.end());
+	}
+	sort(ids.begin(), ids.end());
+	ids.erase(unique(ids.begin(), ids.end()), ids.end());
+	return ids;
+}
+
+void DependencyMonitor::SyncPublish(const vector<unsigned int> &ids) {
+	SyncKeys();
+	vector<DependencySyncEvent> events;
+	for (unsigned int k = 0; k < ids.size(); k++) {
+		unsigned int i = DG->DOI.vi[ids[k]];
+		events.push_back(
+				DependencySyncEvent(ids[k], DG->SyncFrom[i], DG->SyncTo[i],
+						DG->Values->Get(ids[k]), DG->Values.get()));
+	}
+	if (SmartDG_SyncVerbose)
+		cout << Name << " View " << currentView << ":SyncPublish "
+				<< events.size() << endl;
+	DependencySyncBus::Publish(events);
+}
+
+void DependencyMonitor::SyncPoll() {
+	if (!(View2ViewFlag && SmartDG_GlobalData::View2ViewFlag))
+		return;
+	vector<DependencySyncEvent> events;
+	// Events were dropped before this View saw them
+	if (!DependencySyncBus::Poll(SyncSubscriber, events)) {
 		SyncIn();
+		return;
+	}
+	SyncKeys();
+	for (unsigned int e = 0; e < events.size(); e++) {
+		// Shared Values already hold the change
+		if (events[e].source == DG->Values.get())
+			continue;
+		// Applies events of DependencyGraph objects with the same udi only
+		unsigned int id = events[e].vid;
+		if ((id >= DG->DOI.vi.size())
+				|| (DG->SyncFrom[DG->DOI.vi[id]] != events[e].from)
+				|| (DG->SyncTo[DG->DOI.vi[id]] != events[e].to))
+			continue;
+		DG->Values->Set(id, events[e].data);
 	}
+	if (SmartDG_SyncVerbose)
+		cout << Name << " View " << currentView << ":SyncPoll "
+				<< events.size() << endl;
 }
 
 void DependencyMonitor::SyncOut() {
 	if (View2ViewFlag && SmartDG_GlobalData::View2ViewFlag) {
-		system(SmartDG_XMESSAGE_SYNC_COMMAND);
 		if (SmartDG_SyncVerbose) {
 			if (Mode == SmartDG_OBJECT_MODE)
 				cout << Name << " ObjectView " << currentView << ":SyncOut"
@@ -1862,14 +1694,12 @@ void DependencyMonitor::SyncOut() {
 				cout << Name << " ComponentView " << currentComponent
 						<< ":SyncOut" << endl;
 		}
-		for (unsigned int i = 0; i < DG.DOI.I.size(); i++) {
-			URL f = DG.DOI.I[i].pou;
-			URL t = DG.DOI.I[i].tou;
-			SmartDG_GlobalData::GlobalPackage[f.str][t.str].Set(
-					DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].udi[t.str].Get());
+		SyncKeys();
+		for (unsigned int i = 0; i < DG->DOI.I.size(); i++) {
+			SmartDG_GlobalData::GlobalPackage.Set(DG->SyncFrom[i], DG->SyncTo[i],
+					DG->Values->Get(DG->DOI.I[i].vid));
 			if (SmartDG_SyncVerbose)
-				cout
-						<< DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].udi[t.str].Get();
+				cout << DG->Values->Get(DG->DOI.I[i].vid);
 		}
 		if (SmartDG_SyncVerbose)
 			cout << endl;
@@ -1878,7 +1708,6 @@ void DependencyMonitor::SyncOut() {
 
 void DependencyMonitor::SyncIn() {
 	if (View2ViewFlag && SmartDG_GlobalData::View2ViewFlag) {
-		system(SmartDG_XMESSAGE_SYNC_COMMAND);
 		if (SmartDG_SyncVerbose) {
 			if (Mode == SmartDG_OBJECT_MODE)
 				cout << Name << " ObjectView " << currentView << ":SyncIn"
@@ -1887,71 +1716,130 @@ void DependencyMonitor::SyncIn() {
 				cout << Name << " ComponentView " << currentComponent
 						<< ":SyncIn" << endl;
 		}
-		for (unsigned int i = 0; i < DG.DOI.I.size(); i++) {
-			URL f = DG.DOI.I[i].pou;
-			URL t = DG.DOI.I[i].tou;
-			DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].udi[t.str].Set(
-					SmartDG_GlobalData::GlobalPackage[f.str][t.str].Get());
+		SyncKeys();
+		DG->Values->ClearChanged();
+		// Only GlobalPackage entries changed since the last Sync in
+		vector<unsigned int> entries;
+		SyncVersion = SmartDG_GlobalData::GlobalPackage.Since(SyncVersion,
+				entries);
+		for (unsigned int e = 0; e < entries.size(); e++) {
+			unordered_map<uint64_t, unsigned int>::iterator it = DG->SyncIndex.find(
+					SmartDG_GlobalData::GlobalPackage.keys[entries[e]]);
+			if (it == DG->SyncIndex.end())
+				continue;
+			DG->Values->Set(DG->DOI.I[it->second].vid,
+					SmartDG_GlobalData::GlobalPackage.data[entries[e]]);
 			if (SmartDG_SyncVerbose)
-				cout
-						<< DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].udi[t.str].Get();
+				cout << DG->Values->Get(DG->DOI.I[it->second].vid);
 		}
 		if (SmartDG_SyncVerbose)
 			cout << endl;
+		// Data from other Views may break the local fixed point
+		if (DG->Values->Changed() > 0)
+			SolverContext = "";
 	}
 }
 
-void DependencyMonitor::SyncOutLiteInit() {
-	for (unsigned int i = 0; i < DG.DOI.I.size(); i++) {
-		URL f = DG.DOI.I[i].pou;
-		URL t = DG.DOI.I[i].tou;
-		SmartDG_GlobalData::GlobalPackageLite["#" + f.dotless("x") + "x"
-				+ t.dotless("x") + "x"] = "F";
-		SmartDG_GlobalData::GlobalPackageLite["#" + f.dotless("x") + "xAllx"] =
-				"F";
+void DependencyMonitor::SyncKeys() {
+	if (DG->SyncFrom.size() == DG->DOI.I.size())
+		return;
+	DG->SyncFrom.resize(DG->DOI.I.size());
+	DG->SyncTo.resize(DG->DOI.I.size());
+	DG->SyncIndex.clear();
+	for (unsigned int i = 0; i < DG->DOI.I.size(); i++) {
+		DG->SyncFrom[i] = SmartDG_GlobalData::GlobalPackage.Intern(
+				DG->DOI.I[i].pou.str());
+		DG->SyncTo[i] = SmartDG_GlobalData::GlobalPackage.Intern(
+				DG->DOI.I[i].tou.str());
+		DG->SyncIndex[(uint64_t(DG->SyncFrom[i]) << 32) | DG->SyncTo[i]] = i;
+	}
+	// DGlite element ids of the udi and of its DependencyObject
+	DG->LiteKeys.resize(DG->DOI.I.size());
+	DG->LiteAllKeys.resize(DG->DOI.I.size());
+	for (unsigned int i = 0; i < DG->DOI.I.size(); i++) {
+		string f = DG->DOI.I[i].pou.dotless("x");
+		DG->LiteKeys[i] = "#" + f + "x" + DG->DOI.I[i].tou.dotless("x") + "x";
+		DG->LiteAllKeys[i] = "#" + f + "xAllx";
 	}
 }
 
+void DependencyMonitor::SyncOutLiteInit() {
+	for (unsigned int i = 0; i < DG->DOI.I.size(); i++) {
+		URL f = DG->DOI.I[i].pou;
+		URL t = DG->DOI.I[i].tou;
+		SmartDG_GlobalData::GlobalPackageLite.Set(
+				"#" + f.dotless("x") + "x" + t.dotless("x") + "x", "F");
+		SmartDG_GlobalData::GlobalPackageLite.Set(
+				"#" + f.dotless("x") + "xAllx", "F");
+	}
+	SmartDG_GlobalData::GlobalPackageLite.Publish();
+}
+
 void DependencyMonitor::SyncOutLite(bool useglobal) {
+	if (DisplayMode == SmartDG_FLTK_DISPLAYMODE)
+		return;
+	// DependencyObjects without udi
+	for (unsigned int n = 0; n < DG->DN.size(); n++)
+		for (unsigned int io = 0; io < 2; io++)
+			for (unsigned int p = 0; p < DG->DN[n].DP[io].size(); p++)
+				for (unsigned int o = 0; o < DG->DN[n].DP[io][p].DO.size(); o++)
+					if (DG->DN[n].DP[io][p].DO[o].Instances() == 0)
+						SmartDG_GlobalData::GlobalPackageLite.Set(
+								"#" + DG->DN[n].DP[io][p].DO[o].url.dotless("x")
+										+ "xAllx", "NA");
+	// All udi
+	vector<unsigned int> ids(DG->Values->size());
+	for (unsigned int k = 0; k < ids.size(); k++)
+		ids[k] = k;
+	SyncOutLite(ids, useglobal);
+}
+
+void DependencyMonitor::SyncOutLite(const vector<unsigned int> &ids,
+		bool useglobal) {
 	if (DisplayMode != SmartDG_FLTK_DISPLAYMODE) {
 		if (SmartDG_SyncLiteVerbose)
 			cout << DisplayMode << " SyncOutLite::";
-		for (unsigned int i = 0; i < DG.DOI.I.size(); i++) {
-			URL f = DG.DOI.I[i].pou;
-			URL t = DG.DOI.I[i].tou;
-			if (useglobal)
-				SmartDG_GlobalData::GlobalPackageLite["#" + f.dotless("x") + "x"
-						+ t.dotless("x") + "x"] =
-						SmartDG_GlobalData::GlobalPackage[f.str][t.str].toStr();
-			else
-				SmartDG_GlobalData::GlobalPackageLite["#" + f.dotless("x") + "x"
-						+ t.dotless("x") + "x"] =
-						DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].udi[t.str].toStr();
+		SyncKeys();
+		// Value of DG->DOI.I entry i
+		auto value = [&](unsigned int i) {
+			return useglobal ?
+					SmartDG_GlobalData::GlobalPackage.Get(DG->SyncFrom[i], DG->SyncTo[i]) :
+					DG->Values->Get(DG->DOI.I[i].vid);
+		};
+		// DependencyObjects of the udi, as DG->DOI.I entry of their first udi
+		vector<unsigned int> objects;
+		for (unsigned int k = 0; k < ids.size(); k++) {
+			if (ids[k] >= DG->DOI.vi.size())
+				continue;
+			unsigned int i = DG->DOI.vi[ids[k]];
+			SmartDG_GlobalData::GlobalPackageLite.Set(DG->LiteKeys[i],
+					value(i).toStr());
+			URL f = DG->DOI.I[i].pou;
+			objects.push_back(
+					DG->DOI.vi[DG->DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].udv[0]]);
 			if (SmartDG_SyncLiteVerbose)
-				cout << "|"
-						<< SmartDG_GlobalData::GlobalPackageLite["#"
-								+ f.dotless("x") + "x" + t.dotless("x") + "x"];
+				cout << "|" << SmartDG_GlobalData::GlobalPackageLite.Get(
+						DG->LiteKeys[i]);
 		}
 		if (SmartDG_SyncLiteVerbose)
 			cout << endl;
-		for (unsigned int n = 0; n < DG.DN.size(); n++)
-			for (unsigned int io = 0; io < 2; io++)
-				for (unsigned int p = 0; p < DG.DN[n].DP[io].size(); p++)
-					for (unsigned int o = 0; o < DG.DN[n].DP[io][p].DO.size();
-							o++) {
-						DependencyObject tmpObj = DG.DN[n].DP[io][p].DO[o];
-						for (map<string, DependencyDataPackage>::const_iterator it =
-								tmpObj.udi.begin(); it != tmpObj.udi.end();
-								++it)
-							tmpObj.udi[it->first] =
-									SmartDG_GlobalData::GlobalPackage[tmpObj.url.str][it->first];
-						string id = "#" + tmpObj.url.dotless("x") + "xAllx";
-						if (tmpObj.GetBias() >= 0)
-							SmartDG_GlobalData::GlobalPackageLite[id] =
-									to_string(tmpObj.GetBias());
-						else
-							SmartDG_GlobalData::GlobalPackageLite[id] = "NA";
-					}
+		// Bias towards "true" of all udi of every changed DependencyObject (as DependencyObject::GetBias())
+		sort(objects.begin(), objects.end());
+		objects.erase(unique(objects.begin(), objects.end()), objects.end());
+		for (unsigned int k = 0; k < objects.size(); k++) {
+			unsigned int i = objects[k];
+			URL f = DG->DOI.I[i].pou;
+			DependencyObject &obj =
+					DG->DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex];
+			double tot = 0;
+			for (unsigned int u = 0; u < obj.Instances(); u++)
+				if (value(DG->DOI.vi[obj.udv[u]]).b)
+					tot++;
+			SmartDG_GlobalData::GlobalPackageLite.Set(DG->LiteAllKeys[i],
+					to_string((int) round((tot / obj.Instances()) * 10)));
+		}
+		// Makes the entries visible to the DGlite server at once
+		SmartDG_GlobalData::GlobalPackageLite.Publish();
 	}
 }
 
@@ -1961,44 +1849,44 @@ void DependencyMonitor::SyncInLite() {
 
 void DependencyMonitor::ShowLines() {
 	if (Mode == SmartDG_OBJECT_MODE) {
-		for (unsigned int j = 0; j < DG.dobjs.size(); j++) {
-			string obj = DG.dobjs[j];
+		for (unsigned int j = 0; j < DG->dobjs.size(); j++) {
+			string obj = DG->dobjs[j];
 			if (obj == currentView)
-				for (unsigned int i = 0; i < DG.View[obj].size(); i++) {
-					URL f = DG.View[obj][i].From;
+				for (unsigned int i = 0; i < DG->View[obj].size(); i++) {
+					URL f = DG->View[obj][i].From;
 					unsigned int fx =
-							DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].Shape->x();
+							Widgets[f.NodeIndex].ObjectShape[f.InOutIndex][f.PortIndex][f.ObjectIndex]->x();
 					unsigned int fy =
-							DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].Shape->y();
-					URL t = DG.View[obj][i].To;
+							Widgets[f.NodeIndex].ObjectShape[f.InOutIndex][f.PortIndex][f.ObjectIndex]->y();
+					URL t = DG->View[obj][i].To;
 					unsigned int tx =
-							DG.DN[t.NodeIndex].DP[t.InOutIndex][t.PortIndex].DO[t.ObjectIndex].Shape->x();
+							Widgets[t.NodeIndex].ObjectShape[t.InOutIndex][t.PortIndex][t.ObjectIndex]->x();
 					unsigned int ty =
-							DG.DN[t.NodeIndex].DP[t.InOutIndex][t.PortIndex].DO[t.ObjectIndex].Shape->y();
+							Widgets[t.NodeIndex].ObjectShape[t.InOutIndex][t.PortIndex][t.ObjectIndex]->y();
 					unsigned int lmx = (fx + tx + SmartDG_IWW) / 2;
 					unsigned int lmy = (fy + ty + SmartDG_IWW) / 2;
 					if (USEGRID)
 						Snap2Grid(lmx, lmy);
-					GridXY[f.str][t.str].push_back(lmx);
-					GridXY[f.str][t.str].push_back(lmy);
+					GridXY[f.str()][t.str()].push_back(lmx);
+					GridXY[f.str()][t.str()].push_back(lmy);
 					if (USEGRID)
 						AdjustGridXY();
-					DG.View[obj][i].con = new GUIConnection(
-							DG.View[obj][i].Name, fx + SmartDG_IWW,
+					Connections[DG->View[obj][i].id] = new GUIConnection(
+							DG->View[obj][i].Name, fx + SmartDG_IWW,
 							fy + SmartDG_IWW / 2, tx, ty + SmartDG_IWW / 2,
 							string(
-									DG.View[obj][i].From.strp + "."
-											+ DG.View[obj][i].From.stro),
+									DG->View[obj][i].From.strp() + "."
+											+ DG->View[obj][i].From.stro()),
 							string(
-									DG.View[obj][i].To.strp + "."
-											+ DG.View[obj][i].To.stro),
-							fcount[DG.View[obj][i].From.str]--,
-							tcount[DG.View[obj][i].To.str]--,
-							GridXY[f.str][t.str][0], GridXY[f.str][t.str][1],
+									DG->View[obj][i].To.strp() + "."
+											+ DG->View[obj][i].To.stro()),
+							fcount[DG->View[obj][i].From.str()]--,
+							tcount[DG->View[obj][i].To.str()]--,
+							GridXY[f.str()][t.str()][0], GridXY[f.str()][t.str()][1],
 							SmartDG_LCOLOR, SmartDG_LINETHICKNESS);
-					DG.View[obj][i].con->Fill(
-							DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].udi[t.str],
-							DG.DN[t.NodeIndex].DP[t.InOutIndex][t.PortIndex].DO[t.ObjectIndex].udi[f.str]);
+					Connections[DG->View[obj][i].id]->Fill(
+							DG->Values->Get(DG->View[obj][i].FromValue()),
+							DG->Values->Get(DG->View[obj][i].ToValue()));
 				}
 		}
 	}
@@ -2010,14 +1898,14 @@ void DependencyMonitor::ShowLines() {
 		unsigned int fcounter = 0;
 		unsigned int tcounter = 0;
 
-		for (unsigned int j = 0; j < DG.dobjs.size(); j++) {
-			string obj = DG.dobjs[j];
-			for (unsigned int i = 0; i < DG.View[obj].size(); i++) {
-				URL f = DG.View[obj][i].From;
-				URL t = DG.View[obj][i].To;
-				if (f.strn == currentComponent)
+		for (unsigned int j = 0; j < DG->dobjs.size(); j++) {
+			string obj = DG->dobjs[j];
+			for (unsigned int i = 0; i < DG->View[obj].size(); i++) {
+				URL f = DG->View[obj][i].From;
+				URL t = DG->View[obj][i].To;
+				if (f.strn() == currentComponent)
 					fcounter++;
-				if (t.strn == currentComponent)
+				if (t.strn() == currentComponent)
 					tcounter++;
 			}
 		}
@@ -2038,20 +1926,20 @@ void DependencyMonitor::ShowLines() {
 
 		map<string, unsigned int> FX, FY, TX, TY;
 
-		for (unsigned int i = 0; i < DG.DN.size(); i++) {
-			if (DG.DN[i].Name == currentComponent) {
-				for (unsigned int j = 0; j < DG.DN[i].DP[1].size(); j++) {
-					for (unsigned int l = 0; l < DG.DN[i].DP[1][j].DO.size();
+		for (unsigned int i = 0; i < DG->DN.size(); i++) {
+			if (DG->DN[i].Name == currentComponent) {
+				for (unsigned int j = 0; j < DG->DN[i].DP[1].size(); j++) {
+					for (unsigned int l = 0; l < DG->DN[i].DP[1][j].DO.size();
 							l++) {
-						URL f = DG.DN[i].DP[1][j].DO[l].url;
-						for (map<string, DependencyDataPackage>::const_iterator it =
-								DG.DN[i].DP[1][j].DO[l].udi.begin();
-								it != DG.DN[i].DP[1][j].DO[l].udi.end(); ++it) {
-							string kstr = f.str + it->first;
+						URL f = DG->DN[i].DP[1][j].DO[l].url;
+						for (unsigned int u = 0; u < DG->DN[i].DP[1][j].DO[l].Instances();
+								u++) {
+							string key = DG->DN[i].DP[1][j].DO[l].udk[u];
+							string kstr = f.str() + key;
 							FX[kstr] =
-									DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].Shape->x()+SmartDG_IWW;
+									Widgets[f.NodeIndex].ObjectShape[f.InOutIndex][f.PortIndex][f.ObjectIndex]->x()+SmartDG_IWW;
 							FY[kstr] =
-									DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].Shape->y()
+									Widgets[f.NodeIndex].ObjectShape[f.InOutIndex][f.PortIndex][f.ObjectIndex]->y()
 											+ SmartDG_IWW / 2;
 							TX[kstr] = ftargetx
 									- SmartDG_COMPONENTMODE_MARGIN_WIRE
@@ -2062,18 +1950,18 @@ void DependencyMonitor::ShowLines() {
 						}
 					}
 				}
-				for (unsigned int j = 0; j < DG.DN[i].DP[0].size(); j++) {
-					for (unsigned int l = 0; l < DG.DN[i].DP[0][j].DO.size();
+				for (unsigned int j = 0; j < DG->DN[i].DP[0].size(); j++) {
+					for (unsigned int l = 0; l < DG->DN[i].DP[0][j].DO.size();
 							l++) {
-						URL t = DG.DN[i].DP[0][j].DO[l].url;
-						for (map<string, DependencyDataPackage>::const_iterator it =
-								DG.DN[i].DP[0][j].DO[l].udi.begin();
-								it != DG.DN[i].DP[0][j].DO[l].udi.end(); ++it) {
-							string kstr = t.str + it->first;
+						URL t = DG->DN[i].DP[0][j].DO[l].url;
+						for (unsigned int u = 0; u < DG->DN[i].DP[0][j].DO[l].Instances();
+								u++) {
+							string key = DG->DN[i].DP[0][j].DO[l].udk[u];
+							string kstr = t.str() + key;
 							TX[kstr] =
-									DG.DN[t.NodeIndex].DP[t.InOutIndex][t.PortIndex].DO[t.ObjectIndex].Shape->x();
+									Widgets[t.NodeIndex].ObjectShape[t.InOutIndex][t.PortIndex][t.ObjectIndex]->x();
 							TY[kstr] =
-									DG.DN[t.NodeIndex].DP[t.InOutIndex][t.PortIndex].DO[t.ObjectIndex].Shape->y()
+									Widgets[t.NodeIndex].ObjectShape[t.InOutIndex][t.PortIndex][t.ObjectIndex]->y()
 											+ SmartDG_IWW / 2;
 							FX[kstr] = ttargetx
 									+ SmartDG_COMPONENTMODE_MARGIN_WIRE
@@ -2086,14 +1974,14 @@ void DependencyMonitor::ShowLines() {
 				}
 			}
 		}
-		for (unsigned int j = 0; j < DG.dobjs.size(); j++) {
-			string obj = DG.dobjs[j];
-			for (unsigned int i = 0; i < DG.View[obj].size(); i++) {
-				URL f = DG.View[obj][i].From;
-				URL t = DG.View[obj][i].To;
+		for (unsigned int j = 0; j < DG->dobjs.size(); j++) {
+			string obj = DG->dobjs[j];
+			for (unsigned int i = 0; i < DG->View[obj].size(); i++) {
+				URL f = DG->View[obj][i].From;
+				URL t = DG->View[obj][i].To;
 				unsigned int fx, fy, tx, ty, lmx, lmy;
-				if (f.strn == currentComponent) {
-					string kstr = f.str + t.str;
+				if (f.strn() == currentComponent) {
+					string kstr = f.str() + t.str();
 					fx = FX[kstr];
 					fy = FY[kstr];
 					tx = TX[kstr];
@@ -2102,30 +1990,30 @@ void DependencyMonitor::ShowLines() {
 					lmy = ty;
 					if (USEGRID)
 						Snap2Grid(lmx, lmy);
-					GridXY[f.str][t.str].push_back(lmx);
-					GridXY[f.str][t.str].push_back(lmy);
+					GridXY[f.str()][t.str()].push_back(lmx);
+					GridXY[f.str()][t.str()].push_back(lmy);
 					if (USEGRID)
 						AdjustGridXY();
-					string lab = DG.View[obj][i].To.strn + "."
-							+ DG.View[obj][i].To.strp;
-					DG.View[obj][i].con = new GUIConnection(
-							DG.View[obj][i].Name, compmode, lab, fx, fy, tx, ty,
+					string lab = DG->View[obj][i].To.strn() + "."
+							+ DG->View[obj][i].To.strp();
+					Connections[DG->View[obj][i].id] = new GUIConnection(
+							DG->View[obj][i].Name, compmode, lab, fx, fy, tx, ty,
 							string(
-									DG.View[obj][i].From.strp + "."
-											+ DG.View[obj][i].From.stro),
+									DG->View[obj][i].From.strp() + "."
+											+ DG->View[obj][i].From.stro()),
 							string(
-									DG.View[obj][i].To.strp + "."
-											+ DG.View[obj][i].To.stro),
-							fcount[DG.View[obj][i].From.str]--,
-							tcount[DG.View[obj][i].To.str]--,
-							GridXY[f.str][t.str][0], GridXY[f.str][t.str][1],
+									DG->View[obj][i].To.strp() + "."
+											+ DG->View[obj][i].To.stro()),
+							fcount[DG->View[obj][i].From.str()]--,
+							tcount[DG->View[obj][i].To.str()]--,
+							GridXY[f.str()][t.str()][0], GridXY[f.str()][t.str()][1],
 							SmartDG_LCOLOR, SmartDG_LINETHICKNESS);
-					DG.View[obj][i].con->Fill(
-							DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].udi[t.str],
-							DG.DN[t.NodeIndex].DP[t.InOutIndex][t.PortIndex].DO[t.ObjectIndex].udi[f.str]);
+					Connections[DG->View[obj][i].id]->Fill(
+							DG->Values->Get(DG->View[obj][i].FromValue()),
+							DG->Values->Get(DG->View[obj][i].ToValue()));
 				} else {
-					if (t.strn == currentComponent) {
-						string kstr = t.str + f.str;
+					if (t.strn() == currentComponent) {
+						string kstr = t.str() + f.str();
 						tx = TX[kstr];
 						ty = TY[kstr];
 						fx = FX[kstr];
@@ -2134,31 +2022,31 @@ void DependencyMonitor::ShowLines() {
 						lmy = fy;
 						if (USEGRID)
 							Snap2Grid(lmx, lmy);
-						GridXY[f.str][t.str].push_back(lmx);
-						GridXY[f.str][t.str].push_back(lmy);
+						GridXY[f.str()][t.str()].push_back(lmx);
+						GridXY[f.str()][t.str()].push_back(lmy);
 						if (USEGRID)
 							AdjustGridXY();
-						string lab = DG.View[obj][i].From.strn + "."
-								+ DG.View[obj][i].From.strp;
-						DG.View[obj][i].con = new GUIConnection(
-								DG.View[obj][i].Name, compmode, lab, fx, fy, tx,
+						string lab = DG->View[obj][i].From.strn() + "."
+								+ DG->View[obj][i].From.strp();
+						Connections[DG->View[obj][i].id] = new GUIConnection(
+								DG->View[obj][i].Name, compmode, lab, fx, fy, tx,
 								ty,
 								string(
-										DG.View[obj][i].From.strp + "."
-												+ DG.View[obj][i].From.stro),
+										DG->View[obj][i].From.strp() + "."
+												+ DG->View[obj][i].From.stro()),
 								string(
-										DG.View[obj][i].To.strp + "."
-												+ DG.View[obj][i].To.stro),
-								fcount[DG.View[obj][i].From.str]--,
-								tcount[DG.View[obj][i].To.str]--,
-								GridXY[f.str][t.str][0],
-								GridXY[f.str][t.str][1],
+										DG->View[obj][i].To.strp() + "."
+												+ DG->View[obj][i].To.stro()),
+								fcount[DG->View[obj][i].From.str()]--,
+								tcount[DG->View[obj][i].To.str()]--,
+								GridXY[f.str()][t.str()][0],
+								GridXY[f.str()][t.str()][1],
 								SmartDG_LCOLOR, SmartDG_LINETHICKNESS);
-						DG.View[obj][i].con->Fill(
-								DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].udi[t.str],
-								DG.DN[t.NodeIndex].DP[t.InOutIndex][t.PortIndex].DO[t.ObjectIndex].udi[f.str]);
+						Connections[DG->View[obj][i].id]->Fill(
+								DG->Values->Get(DG->View[obj][i].FromValue()),
+								DG->Values->Get(DG->View[obj][i].ToValue()));
 					} else {
-						DG.View[obj][i].con = new GUIConnection();
+						Connections[DG->View[obj][i].id] = new GUIConnection();
 					}
 				}
 			}
@@ -2217,32 +2105,32 @@ void DependencyMonitor::AdjustGridXY() {
 
 void DependencyMonitor::Generate_Dependency_Tabs() {
 	if (Mode == SmartDG_OBJECT_MODE) {
-		for (unsigned int i = 0; i < DG.View[currentView].size(); i++) {
-			if (fcount[DG.View[currentView][i].From.str])
-				fcount[DG.View[currentView][i].From.str]++;
+		for (unsigned int i = 0; i < DG->View[currentView].size(); i++) {
+			if (fcount[DG->View[currentView][i].From.str()])
+				fcount[DG->View[currentView][i].From.str()]++;
 			else
-				fcount[DG.View[currentView][i].From.str] = 1;
+				fcount[DG->View[currentView][i].From.str()] = 1;
 
-			if (tcount[DG.View[currentView][i].To.str])
-				tcount[DG.View[currentView][i].To.str]++;
+			if (tcount[DG->View[currentView][i].To.str()])
+				tcount[DG->View[currentView][i].To.str()]++;
 			else
-				tcount[DG.View[currentView][i].To.str] = 1;
+				tcount[DG->View[currentView][i].To.str()] = 1;
 		}
 	}
 	if ((Mode == SmartDG_COMPONENT_MODE)
 			|| (Mode == SmartDG_COMPONENT_DEVELOPER_MODE)) {
-		for (unsigned int s = 0; s < DG.dobjs.size(); s++) {
-			string obj = DG.dobjs[s];
-			for (unsigned int i = 0; i < DG.View[obj].size(); i++) {
-				if (fcount[DG.View[obj][i].From.str])
-					fcount[DG.View[obj][i].From.str]++;
+		for (unsigned int s = 0; s < DG->dobjs.size(); s++) {
+			string obj = DG->dobjs[s];
+			for (unsigned int i = 0; i < DG->View[obj].size(); i++) {
+				if (fcount[DG->View[obj][i].From.str()])
+					fcount[DG->View[obj][i].From.str()]++;
 				else
-					fcount[DG.View[obj][i].From.str] = 1;
+					fcount[DG->View[obj][i].From.str()] = 1;
 
-				if (tcount[DG.View[obj][i].To.str])
-					tcount[DG.View[obj][i].To.str]++;
+				if (tcount[DG->View[obj][i].To.str()])
+					tcount[DG->View[obj][i].To.str()]++;
 				else
-					tcount[DG.View[obj][i].To.str] = 1;
+					tcount[DG->View[obj][i].To.str()] = 1;
 			}
 		}
 	}
@@ -2250,29 +2138,25 @@ void DependencyMonitor::Generate_Dependency_Tabs() {
 
 void DependencyMonitor::RefreshMonitorData(string obj, bool refreshGUI) {
 	if (Mode == SmartDG_OBJECT_MODE) {
-		for (unsigned int i = 0; i < DG.View[string(obj)].size(); i++) {
-			URL f = DG.View[obj][i].From;
-			URL t = DG.View[obj][i].To;
+		for (unsigned int i = 0; i < DG->View[string(obj)].size(); i++) {
 			// Fills latest DependencyObject instance data (Name : obj) to GUI connections
-			DG.View[obj][i].con->Fill(
-					DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].udi[t.str],
-					DG.DN[t.NodeIndex].DP[t.InOutIndex][t.PortIndex].DO[t.ObjectIndex].udi[f.str]);
+			Connections[DG->View[obj][i].id]->Fill(
+					DG->Values->Get(DG->View[obj][i].FromValue()),
+					DG->Values->Get(DG->View[obj][i].ToValue()));
 		}
 		if (refreshGUI)
 			RefreshMonitor();
 	}
 	if ((Mode == SmartDG_COMPONENT_MODE)
 			|| (Mode == SmartDG_COMPONENT_DEVELOPER_MODE)) {
-		for (unsigned int s = 0; s < DG.dobjs.size(); s++) {
-			obj = DG.dobjs[s];
-			for (unsigned int i = 0; i < DG.View[string(DG.dobjs[s])].size();
+		for (unsigned int s = 0; s < DG->dobjs.size(); s++) {
+			obj = DG->dobjs[s];
+			for (unsigned int i = 0; i < DG->View[string(DG->dobjs[s])].size();
 					i++) {
-				URL f = DG.View[obj][i].From;
-				URL t = DG.View[obj][i].To;
 				// Fills latest DependencyObject instance data (Name : obj) to GUI connections
-				DG.View[obj][i].con->Fill(
-						DG.DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].udi[t.str],
-						DG.DN[t.NodeIndex].DP[t.InOutIndex][t.PortIndex].DO[t.ObjectIndex].udi[f.str]);
+				Connections[DG->View[obj][i].id]->Fill(
+						DG->Values->Get(DG->View[obj][i].FromValue()),
+						DG->Values->Get(DG->View[obj][i].ToValue()));
 			}
 		}
 		if (refreshGUI)
@@ -2283,9 +2167,9 @@ void DependencyMonitor::RefreshMonitorData(string obj, bool refreshGUI) {
 void DependencyMonitor::RefreshMonitorData(bool refreshGUI) {
 	if (Mode == SmartDG_OBJECT_MODE) {
 		// For all objects in DependencyGraph DG (DependencyGraph::dobjs)
-		for (unsigned int i = 0; i < DG.dobjs.size(); i++) {
+		for (unsigned int i = 0; i < DG->dobjs.size(); i++) {
 			// Calls RefreshMonitorData(obj, refreshGUI)
-			RefreshMonitorData(DG.dobjs[i], false);
+			RefreshMonitorData(DG->dobjs[i], false);
 		}
 		if (refreshGUI)
 			RefreshMonitor();
@@ -2306,57 +2190,57 @@ void DependencyMonitor::RefreshMonitor() {
 }
 
 void DependencyMonitor::ResetDOIFlags(bool b, unsigned int c) {
-	DG.DOI.ResetContext(b);
-	DG.DOI.SetFlagContext(b, c);
+	Context.ResetContext(b);
+	Context.SetFlagContext(b, c);
 	RefreshEditMenu();
 	RefreshNodeEditMenu();
 }
 
 void DependencyMonitor::RefreshDOIFlags(string v, string n, string i, string p,
 		string o, bool b, unsigned int c) {
-	DG.DOI.SetContext(v, n, i, p, o);
-	DG.DOI.SetFlagContext(b, c);
+	Context.SetContext(v, n, i, p, o);
+	Context.SetFlagContext(b, c);
 	RefreshEditMenu();
 	RefreshNodeEditMenu();
 }
 
 void DependencyMonitor::RefreshDOIFlagsHierarchy(string v, string n, string i,
 		string p, string o, bool b, unsigned int c) {
-	DG.DOI.SetContextHierarchy(v, n, i, p, o);
-	DG.DOI.SetFlagContext(b, c);
+	Context.SetContextHierarchy(v, n, i, p, o);
+	Context.SetFlagContext(b, c);
 	RefreshEditMenu();
 	RefreshNodeEditMenu();
 }
 
 void DependencyMonitor::RefreshDOIFlagsURL(string u, bool b, unsigned int c) {
-	DG.DOI.SetFlagURL(u, b, c);
+	Context.SetFlagURL(u, b, c);
 	RefreshEditMenu();
 	RefreshNodeEditMenu();
 }
 
 void DependencyMonitor::RefreshDOIFlagsMenuIDString(string m, bool b,
 		unsigned int c) {
-	DG.DOI.SetFlagMenuIDString(m, b, c);
+	Context.SetFlagMenuIDString(m, b, c);
 	RefreshEditMenu();
 	RefreshNodeEditMenu();
 }
 
 void DependencyMonitor::RefreshEditMenu() {
 	if (SmartDG_RefreshEditMenuVerbose) {
-		for (unsigned int i = 0; i < DG.DOI.I.size(); i++) {
-			string str1 = "Edit/" + DG.DOI.I[i].midL + "/true";
-			cout << str1 << " set " << DG.DOI.I[i].editable << endl;
-			ShowHideMonitorWindowMenuBar(str1, DG.DOI.I[i].editable);
-			string str2 = "Edit/" + DG.DOI.I[i].midL + "/false";
-			cout << str2 << " set " << DG.DOI.I[i].editable << endl;
-			ShowHideMonitorWindowMenuBar(str2, DG.DOI.I[i].editable);
+		for (unsigned int i = 0; i < DG->DOI.I.size(); i++) {
+			string str1 = "Edit/" + DG->DOI.I[i].midL + "/true";
+			cout << str1 << " set " << Context.editable[i] << endl;
+			ShowHideMonitorWindowMenuBar(str1, Context.editable[i]);
+			string str2 = "Edit/" + DG->DOI.I[i].midL + "/false";
+			cout << str2 << " set " << Context.editable[i] << endl;
+			ShowHideMonitorWindowMenuBar(str2, Context.editable[i]);
 		}
 	} else {
-		for (unsigned int i = 0; i < DG.DOI.I.size(); i++) {
-			ShowHideMonitorWindowMenuBar("Edit/" + DG.DOI.I[i].midL + "/true",
-					DG.DOI.I[i].editable);
-			ShowHideMonitorWindowMenuBar("Edit/" + DG.DOI.I[i].midL + "/false",
-					DG.DOI.I[i].editable);
+		for (unsigned int i = 0; i < DG->DOI.I.size(); i++) {
+			ShowHideMonitorWindowMenuBar("Edit/" + DG->DOI.I[i].midL + "/true",
+					Context.editable[i]);
+			ShowHideMonitorWindowMenuBar("Edit/" + DG->DOI.I[i].midL + "/false",
+					Context.editable[i]);
 		}
 	}
 }
@@ -2374,35 +2258,35 @@ void DependencyMonitor::ShowHideMonitorWindowMenuBar(string item, bool b) {
 
 void DependencyMonitor::RefreshNodeEditMenu() {
 	if (SmartDG_RefreshNodeEditMenuVerbose) {
-		for (unsigned int i = 0; i < DG.DOI.I.size(); i++) {
-			string str1 = "✎/" + DG.DOI.I[i].mid + "/true";
-			cout << DG.DOI.I[i].pou.strio << " " << str1 << " set "
-					<< DG.DOI.I[i].editable << endl;
-			ShowHideNodeMenuBar(str2tog(DG.DOI.I[i].pou.strio), str1,
-					DG.DOI.I[i].editable);
-
-			string str2 = "✎/" + DG.DOI.I[i].mid + "/false";
-			cout << DG.DOI.I[i].pou.strio << " " << str2 << " set "
-					<< DG.DOI.I[i].editable << endl;
-			ShowHideNodeMenuBar(str2tog(DG.DOI.I[i].pou.strio), str2,
-					DG.DOI.I[i].editable);
+		for (unsigned int i = 0; i < DG->DOI.I.size(); i++) {
+			string str1 = "✎/" + DG->DOI.I[i].mid + "/true";
+			cout << DG->DOI.I[i].pou.strio() << " " << str1 << " set "
+					<< Context.editable[i] << endl;
+			ShowHideNodeMenuBar(str2tog(DG->DOI.I[i].pou.strio()), str1,
+					Context.editable[i]);
+
+			string str2 = "✎/" + DG->DOI.I[i].mid + "/false";
+			cout << DG->DOI.I[i].pou.strio() << " " << str2 << " set "
+					<< Context.editable[i] << endl;
+			ShowHideNodeMenuBar(str2tog(DG->DOI.I[i].pou.strio()), str2,
+					Context.editable[i]);
 		}
 	} else {
-		for (unsigned int i = 0; i < DG.DOI.I.size(); i++) {
-			ShowHideNodeMenuBar(str2tog(DG.DOI.I[i].pou.strio),
-					"✎/" + DG.DOI.I[i].mid + "/true", DG.DOI.I[i].editable);
-			ShowHideNodeMenuBar(str2tog(DG.DOI.I[i].pou.strio),
-					"✎/" + DG.DOI.I[i].mid + "/false", DG.DOI.I[i].editable);
+		for (unsigned int i = 0; i < DG->DOI.I.size(); i++) {
+			ShowHideNodeMenuBar(str2tog(DG->DOI.I[i].pou.strio()),
+					"✎/" + DG->DOI.I[i].mid + "/true", Context.editable[i]);
+			ShowHideNodeMenuBar(str2tog(DG->DOI.I[i].pou.strio()),
+					"✎/" + DG->DOI.I[i].mid + "/false", Context.editable[i]);
 		}
 	}
 }
 
 void DependencyMonitor::ShowHideNodeMenuBar(unsigned int tog, string item,
 		bool b) {
-	for (unsigned int i = 0; i < DG.DN.size(); i++) {
+	for (unsigned int i = 0; i < DG->DN.size(); i++) {
 		if (0 == tog) {
-			if (DG.DN[i].BarIn) {
-				Fl_Menu_Item *p = (Fl_Menu_Item*) DG.DN[i].BarIn->find_item(
+			if (Widgets[i].BarIn) {
+				Fl_Menu_Item *p = (Fl_Menu_Item*) Widgets[i].BarIn->find_item(
 						item.c_str());
 				if (p) {
 					if (b)
@@ -2412,8 +2296,8 @@ void DependencyMonitor::ShowHideNodeMenuBar(unsigned int tog, string item,
 				}
 			}
 		} else {
-			if (DG.DN[i].BarOut) {
-				Fl_Menu_Item *p = (Fl_Menu_Item*) DG.DN[i].BarOut->find_item(
+			if (Widgets[i].BarOut) {
+				Fl_Menu_Item *p = (Fl_Menu_Item*) Widgets[i].BarOut->find_item(
 						item.c_str());
 				if (p) {
 					if (b)
@@ -2445,39 +2329,39 @@ void DependencyMonitor::MenuJointRefresh() {
 	}
 	//Edit Menu
 	if (currentDirection > 0) {
-		for (unsigned int i = 0; i < DG.DN.size(); i++) {
-			ShowHideMonitorWindowMenuBar("Edit/" + DG.DN[i].Name + "/In",
+		for (unsigned int i = 0; i < DG->DN.size(); i++) {
+			ShowHideMonitorWindowMenuBar("Edit/" + DG->DN[i].Name + "/In",
 					false);
-			ShowHideMonitorWindowMenuBar("Edit/" + DG.DN[i].Name + "/Out",
+			ShowHideMonitorWindowMenuBar("Edit/" + DG->DN[i].Name + "/Out",
 					true);
 		}
 	} else {
-		for (unsigned int i = 0; i < DG.DN.size(); i++) {
-			ShowHideMonitorWindowMenuBar("Edit/" + DG.DN[i].Name + "/In", true);
-			ShowHideMonitorWindowMenuBar("Edit/" + DG.DN[i].Name + "/Out",
+		for (unsigned int i = 0; i < DG->DN.size(); i++) {
+			ShowHideMonitorWindowMenuBar("Edit/" + DG->DN[i].Name + "/In", true);
+			ShowHideMonitorWindowMenuBar("Edit/" + DG->DN[i].Name + "/Out",
 					false);
 		}
 	}
 
 	//Node Menu
-	for (unsigned int i = 0; i < DG.DN.size(); i++) {
+	for (unsigned int i = 0; i < DG->DN.size(); i++) {
 		if (currentDirection > 0) {
-			for (unsigned int j = 0; j < DG.DN[i].DP[0].size(); j++) {
+			for (unsigned int j = 0; j < DG->DN[i].DP[0].size(); j++) {
 				ShowHideNodeMenuBar(0,
-						string("✎/" + DG.DN[i].DP[0][j].Name).c_str(), false);
+						string("✎/" + DG->DN[i].DP[0][j].Name).c_str(), false);
 			}
-			for (unsigned int j = 0; j < DG.DN[i].DP[1].size(); j++) {
+			for (unsigned int j = 0; j < DG->DN[i].DP[1].size(); j++) {
 				ShowHideNodeMenuBar(1,
-						string("✎/" + DG.DN[i].DP[1][j].Name).c_str(), true);
+						string("✎/" + DG->DN[i].DP[1][j].Name).c_str(), true);
 			}
 		} else {
-			for (unsigned int j = 0; j < DG.DN[i].DP[0].size(); j++) {
+			for (unsigned int j = 0; j < DG->DN[i].DP[0].size(); j++) {
 				ShowHideNodeMenuBar(0,
-						string("✎/" + DG.DN[i].DP[0][j].Name).c_str(), true);
+						string("✎/" + DG->DN[i].DP[0][j].Name).c_str(), true);
 			}
-			for (unsigned int j = 0; j < DG.DN[i].DP[1].size(); j++) {
+			for (unsigned int j = 0; j < DG->DN[i].DP[1].size(); j++) {
 				ShowHideNodeMenuBar(1,
-						string("✎/" + DG.DN[i].DP[1][j].Name).c_str(), false);
+						string("✎/" + DG->DN[i].DP[1][j].Name).c_str(), false);
 			}
 		}
 	}
@@ -2486,8 +2370,11 @@ void DependencyMonitor::MenuJointRefresh() {
 
 void DependencyMonitor::resetConDirection() {
 	if (Mode == SmartDG_OBJECT_MODE) {
-		for (unsigned int i = 0; i < DG.View[currentView].size(); i++)
-			DG.View[currentView][i].con->setDirection(0); // Resets Connection directions to 0
+		for (unsigned int i = 0; i < DG->View[currentView].size(); i++) {
+			DG->View[currentView][i].direction = 0;
+			if (Connections[DG->View[currentView][i].id] != NULL)
+				Connections[DG->View[currentView][i].id]->setDirection(0); // Resets Connection directions to 0
+		}
 		RefreshMonitor();
 	}
 }
@@ -2549,95 +2436,243 @@ void DependencyMonitor::GenDispStr() {
 	if (SolverSync) {
 		DispString = DispString + " | Solver Synced    ҉";
 	}
+	if (SolverStats.solves > 0) {
+		DispString = DispString + " | Solver: " + SolverStats.str();
+	}
+}
+
+void DependencyMonitor::InitWidgets() {
+	// One GUINode per DependencyNode, one GUIConnection pointer per Dependency
+	Widgets.clear();
+	for (unsigned int i = 0; i < DG->DN.size(); i++)
+		Widgets.push_back(GUINode(DG->DN[i]));
+	Connections.assign(DG->Values->size() / 2, NULL);
+	// Menu flags of this DependencyMonitor
+	Context.Attach(DG->DOI);
 }
 
 void DependencyMonitor::Solver(unsigned int doiindex) {
-	cout << endl << "S	O	L	V	E	R" << endl;
-	// #TODO Smarter Solver
-	string obj = DG.DOI.I[doiindex].obj;
-	vector<string> Return;
+	Solver(vector<unsigned int>(1, doiindex));
+}
+
+void DependencyMonitor::Solver(const vector<unsigned int> &doiindices) {
+	SmartDG_TRACE(SmartDG_TRACE_SOLVER, SmartDG_TRACE_EVENT_SOLVE,
+			currentDirection, doiindices.size(), 0, false);
+	// Lists changed value ids for SyncPublish()
+	DG->Changes.record = true;
+	// Counters of all solves of this call, merged by DependencyMonitor::Solved()
+	SolverStats.Reset();
 
 	// Component GUI Windows
 	if ((Mode == SmartDG_COMPONENT_MODE)
 			|| (Mode == SmartDG_COMPONENT_DEVELOPER_MODE)) {
-		unsigned int nodeindex = DG.DOI.I[doiindex].pou.NodeIndex;
-		int direction = DG.DOI.I[doiindex].direction;
-		// Call Component TFs followed by All Connector TFs
-		if (direction > 0) {
-			cout << DG.DN[nodeindex].Name << "[<<] ";
-			DG.DN[nodeindex].TFT("FT", Return, DG.DN[nodeindex].DP);
-		}
-		if (direction < 0) {
-			cout << DG.DN[nodeindex].Name << "[>>] ";
-			DG.DN[nodeindex].TFT("TF", Return, DG.DN[nodeindex].DP);
-		}
-		// Call All Connector TFs
-		for (unsigned int i = 0; i < DG.View[obj].size(); i++) {
-			if (DG.View[obj][i].From.NodeIndex == nodeindex) {
-				cout << DG.DN[nodeindex].Name << "{>>" << DG.View[obj][i].Name
-						<< " ";
-				DG.View[obj][i].TF(DG.DN[nodeindex].DP,
-						DG.DN[DG.View[obj][i].To.NodeIndex].DP,
-						DG.View[obj][i]);
+		// Records changes of this solve only
+		DG->Changes.Reset();
+		DG->Values->Track(&DG->Changes);
+		for (unsigned int k = 0; k < doiindices.size(); k++) {
+			unsigned int doiindex = doiindices[k];
+			string obj = DG->DOI.I[doiindex].obj;
+			unsigned int nodeindex = DG->DOI.I[doiindex].pou.NodeIndex;
+			int direction = DG->DOI.I[doiindex].direction;
+			DG->Stats.Reset(obj, direction);
+			DG->Stats.solves = 1;
+			DG->Stats.passes = 1;
+			unsigned long first = DG->Changes.count;
+			unsigned long before = first;
+			chrono::steady_clock::time_point start =
+					chrono::steady_clock::now();
+			// Call Component TFs followed by All Connector TFs
+			if (direction > 0) {
+				DG->DN[nodeindex].TFT.CallFT(DG->DN[nodeindex].DP,
+						DG->DN[nodeindex].Handles);
+				SmartDG_TRACE(SmartDG_TRACE_CALLS, SmartDG_TRACE_EVENT_NODE, -1,
+						nodeindex, 0, false);
 			}
-			if (DG.View[obj][i].To.NodeIndex == nodeindex) {
-				cout << DG.View[obj][i].Name << "<<}" << DG.DN[nodeindex].Name
-						<< " ";
-				DG.View[obj][i].FT(DG.DN[DG.View[obj][i].From.NodeIndex].DP,
-						DG.DN[nodeindex].DP, DG.View[obj][i]);
+			if (direction < 0) {
+				DG->DN[nodeindex].TFT.CallTF(DG->DN[nodeindex].DP,
+						DG->DN[nodeindex].Handles);
+				SmartDG_TRACE(SmartDG_TRACE_CALLS, SmartDG_TRACE_EVENT_NODE, 1,
+						nodeindex, 0, false);
 			}
+			double seconds = 0;
+			if (SmartDG_SOLVE_NODE_TIMING)
+				seconds = chrono::duration<double>(
+						chrono::steady_clock::now() - start).count();
+			DG->Stats.CountNode(nodeindex, DG->Changes.count != before, seconds);
+			before = DG->Changes.count;
+			// Call All Connector TFs
+			for (unsigned int i = 0; i < DG->View[obj].size(); i++) {
+				if ((DG->View[obj][i].From.NodeIndex == nodeindex)
+						&& DG->View[obj][i].TF) {
+					DG->View[obj][i].TF(DG->DN[nodeindex].DP,
+							DG->DN[DG->View[obj][i].To.NodeIndex].DP,
+							DG->View[obj][i]);
+					SmartDG_TRACE(SmartDG_TRACE_CALLS,
+							SmartDG_TRACE_EVENT_CONNECTOR, 1, DG->View[obj][i].id,
+							0, false);
+					DG->Stats.CountConnector(DG->View[obj][i].id,
+							DG->Changes.count != before);
+					before = DG->Changes.count;
+					DG->View[obj][i].direction = 1;
+				}
+				if ((DG->View[obj][i].To.NodeIndex == nodeindex)
+						&& DG->View[obj][i].FT) {
+					DG->View[obj][i].FT(DG->DN[DG->View[obj][i].From.NodeIndex].DP,
+							DG->DN[nodeindex].DP, DG->View[obj][i]);
+					SmartDG_TRACE(SmartDG_TRACE_CALLS,
+							SmartDG_TRACE_EVENT_CONNECTOR, -1, DG->View[obj][i].id,
+							0, false);
+					DG->Stats.CountConnector(DG->View[obj][i].id,
+							DG->Changes.count != before);
+					before = DG->Changes.count;
+					DG->View[obj][i].direction = -1;
+				}
+			}
+			DG->Stats.time = chrono::duration<double>(
+					chrono::steady_clock::now() - start).count();
+			DG->Stats.changes = DG->Changes.count - first;
+			Solved(*DG, obj, direction, true);
 		}
-		cout << endl;
+		DG->Values->Track(NULL);
 	}
 	// System GUI Windows
 	if (Mode == SmartDG_OBJECT_MODE) {
-		// Call All Connector TFs and All Component TFs till values stabilize
-		for (unsigned int loop = 0;
-				loop < SmartDG_CIRCULAR_DEPENDENCY_BREAKOUT_COUNT; loop++) {
-			DependencyDataPackage::delta = 0;
-			// Call Connector TFs
-			for (unsigned int i = 0; i < DG.View[obj].size(); i++) {
-				if (currentDirection > 0) {
-					cout << DG.View[obj][i].Name << ">> ";
-					DG.View[obj][i].TF(DG.DN[DG.View[obj][i].From.NodeIndex].DP,
-							DG.DN[DG.View[obj][i].To.NodeIndex].DP,
-							DG.View[obj][i]);
-				}
-				if (currentDirection < 0) {
-					cout << "<<" << DG.View[obj][i].Name << " ";
-					DG.View[obj][i].FT(DG.DN[DG.View[obj][i].From.NodeIndex].DP,
-							DG.DN[DG.View[obj][i].To.NodeIndex].DP,
-							DG.View[obj][i]);
-				}
+		// Groups the edited DependencyNodes by View
+		map<string, vector<unsigned int> > seeds;
+		for (unsigned int k = 0; k < doiindices.size(); k++)
+			seeds[DG->DOI.I[doiindices[k]].obj].push_back(
+					DG->DOI.I[doiindices[k]].pou.NodeIndex);
+		// DependencyGraph::Solve() resets DG->Changes, ids of every View are kept for SyncPublish()
+		vector<unsigned int> ids;
+		for (map<string, vector<unsigned int> >::const_iterator it =
+				seeds.begin(); it != seeds.end(); ++it) {
+			vector<Dependency> &V = DG->View[it->first];
+			string context = it->first + "/" + to_string(currentDirection);
+			// Seed the worklist
+			vector<bool> dirtyConnector(V.size(), SolverContext != context);
+			vector<bool> dirtyNode(DG->DN.size(), SolverContext != context);
+			for (unsigned int k = 0; k < it->second.size(); k++) {
+				unsigned int seednode = it->second[k];
+				dirtyNode[seednode] = true;
+				for (unsigned int i = 0; i < V.size(); i++)
+					if ((V[i].From.NodeIndex == seednode)
+							|| (V[i].To.NodeIndex == seednode))
+						dirtyConnector[i] = true;
 			}
-			// Call All Component TFs
-			for (unsigned int j = 0; j < DG.DN.size(); j++) {
-				if (currentDirection > 0) {
-					cout << DG.DN[j].Name << "[>>] ";
-					DG.DN[j].TFT("TF", Return, DG.DN[j].DP);
-				}
-				if (currentDirection < 0) {
-					cout << DG.DN[j].Name << "[<<] ";
-					DG.DN[j].TFT("FT", Return, DG.DN[j].DP);
-				}
-			}
-			cout << "DependencyDataPackage::delta = "
-					<< DependencyDataPackage::delta << endl;
-			if (DependencyDataPackage::delta == 0)
-				break;
-			if (loop + 1 == SmartDG_CIRCULAR_DEPENDENCY_BREAKOUT_COUNT)
-				cout << "ERROR[CIRCULAR_DEPENDENCY_BREAKOUT_COUNT]: Reached"
-						<< endl;
+			SolverContext = "";
+			// Solves headless, GUI is refreshed by DependencyMonitor::Solved()
+			if (DG->Solve(it->first, currentDirection, dirtyConnector,
+					dirtyNode, this))
+				SolverContext = context;
+			ids.insert(ids.end(), DG->Changes.ids.begin(),
+					DG->Changes.ids.end());
 		}
+		DG->Changes.ids = ids;
 	}
+	SolverVersion = DG->Values->version;
 	// Sync with other views
 	if (View2ViewFlag && SmartDG_GlobalData::View2ViewFlag && SolverSync) {
 		if (Mode != SmartDG_COMPONENT_DEVELOPER_MODE) {
-			SyncOI();
+			SyncOI(doiindices);
 		}
 	}
 }
 
+void DependencyMonitor::BeginEdits() {
+	// Applies changes published by other Views
+	SyncPoll();
+	// Data changed by other Views sharing DG->Values breaks the local fixed point
+	if (DG->Values->version != SolverVersion)
+		SolverContext = "";
+	Edits.clear();
+	EditsOpen = true;
+}
+
+void DependencyMonitor::SetEdit(unsigned int doiindex, bool value, bool all) {
+	if (doiindex >= DG->DOI.I.size()) {
+		cout << "ERROR[DOI NOT FOUND]: " << Name << " : " << doiindex << endl;
+		return;
+	}
+	// Outside BeginEdits()/CommitEdits() the edit is a batch of one
+	bool single = !EditsOpen;
+	if (single)
+		BeginEdits();
+	URL f = DG->DOI.I[doiindex].pou;
+	if (all) {
+		// Sets all udi of the DependencyObject
+		DependencyDataPackage d;
+		d.Set(value);
+		DG->DN[f.NodeIndex].DP[f.InOutIndex][f.PortIndex].DO[f.ObjectIndex].Set(
+				d);
+	} else {
+		// Sets the udi only
+		DG->Values->Set(DG->DOI.I[doiindex].vid, value);
+	}
+	Edits.push_back(doiindex);
+	if (single)
+		CommitEdits();
+}
+
+const DependencySolveStats& DependencyMonitor::CommitEdits() {
+	EditsOpen = false;
+	if (Edits.empty())
+		return SolverStats;
+	// One solve, one Sync and one GUI refresh for the whole batch
+	resetConDirection();
+	Solver(Edits);
+	RefreshMonitorData(currentView);
+	Edits.clear();
+	// Status line shows SolverStats
+	if (MonitorWindowScroll != NULL) {
+		GenDispStr();
+		MonitorWindowScroll->label(DispString.c_str());
+	}
+	return SolverStats;
+}
+
+bool DependencyMonitor::Solve(int direction) {
+	return Solve(direction, *DG->Values);
+}
+
+bool DependencyMonitor::Solve(int direction, DependencyDataBuffer &values) {
+	if (Mode != SmartDG_OBJECT_MODE)
+		return false;
+	// Solves headless (no observer), DG is shared with the other DependencyMonitors
+	DependencyDataChanges changes;
+	DependencySolveStats stats;
+	bool converged = DG->Solve(currentView, direction, values, changes, stats);
+	SolverContext = converged ? currentView + "/" + to_string(direction) : "";
+	SolverVersion = values.version;
+	SolverStats.Reset();
+	SolverStats.Merge(stats);
+	return converged;
+}
+
+void DependencyMonitor::SolvedConnector(Dependency &d, int direction,
+		bool changed) {
+	SmartDG_TRACE(SmartDG_TRACE_CALLS, SmartDG_TRACE_EVENT_CONNECTOR, direction,
+			d.id, 0, changed);
+}
+
+void DependencyMonitor::SolvedNode(DependencyNode &n, int direction,
+		bool changed) {
+	// n is an element of DG->DN
+	SmartDG_TRACE(SmartDG_TRACE_CALLS, SmartDG_TRACE_EVENT_NODE, direction,
+			&n - &DG->DN[0], 0, changed);
+}
+
+void DependencyMonitor::Solved(DependencyGraph &G, string obj, int direction,
+		bool converged) {
+	// Applies Connector directions to the GUI
+	vector<Dependency> &V = G.View[obj];
+	for (unsigned int i = 0; i < V.size(); i++)
+		if ((Connections[V[i].id] != NULL) && (V[i].direction != 0))
+			Connections[V[i].id]->setDirection(V[i].direction);
+	SmartDG_TRACE(SmartDG_TRACE_SOLVER, SmartDG_TRACE_EVENT_SOLVED, direction, 0,
+			G.Changes.count, converged);
+	SolverStats.Merge(G.Stats);
+}
+
 // A static unsigned integer that keeps count of DependencyMonitor objects created
 unsigned int DependencyMonitor::count = 0;
 // A static boolean variable part of the mechanism to indicate SmartDG_LITE_DISPLAYMODE
@@ -2646,6 +2681,11 @@ bool DependencyMonitor::MTLiteOn = false;
 bool DependencyMonitor::MTLiteInit = false;
 
 DependencyMonitor::~DependencyMonitor() {
+	// Events are no longer kept for this View
+	DependencySyncBus::Unsubscribe(SyncSubscriber);
+	// The DependencyMonitor owning the DGlite directory stops its server
+	if (!DGliteDir.empty())
+		DependencyLiteServer::Stop();
 }
 
 } /* namespace SmartDG */
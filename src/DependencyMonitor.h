@@ -23,12 +23,13 @@ namespace SmartDG {
 ///	\class DependencyMonitor
 /// \brief DependencyMonitor class generates and manages the GUI for DependencyGraph
 ///
-/// This class encapsulates a DependencyGraph object  and various FLTK Graphics objects,
-/// Menu bar handlers and DependencyGraph data Sync handlers (Multi-View).\n
+/// This class shares a DependencyGraph object with the other DependencyMonitor objects of a system
+/// and encapsulates its own FLTK Graphics objects, menu context, Menu bar handlers and DependencyGraph
+/// data Sync handlers (Multi-View).\n
 /// The class includes several functions and data containers to initiate, record, manage
 /// and  display the aforementioned  entities.
 ////////////////////////////////////////////////////////////////////////////////
-class DependencyMonitor {
+class DependencyMonitor: public DependencyGraphObserver {
 private:
 	// Static data members
 	static unsigned int count; ///< A static unsigned integer that keeps count of DependencyMonitor objects created
@@ -74,6 +75,27 @@ private:
 	//////////////////////////////////////////////////
 	map<string, map<string, vector<unsigned int> > > GridXY;
 	bool SolverSync; ///< A boolean flag which (when set true) initiates data Sync between Views after every local change
+	//////////////////////////////////////////////////
+	/// \var SolverContext
+	/// \brief A string (View/Direction) naming the context in which DependencyMonitor::DG was last
+	/// solved to a fixed point
+	///
+	/// An empty string indicates that the DependencyGraph data may not be at a fixed point
+	/// (initial values, changes Synced in from other Views, Debug toggles or a Solver breakout) and
+	/// that the next call to DependencyMonitor::Solver() must seed every Connector and
+	/// DependencyNode instead of only the edited one.
+	//////////////////////////////////////////////////
+	string SolverContext;
+	unsigned int SyncSubscriber; ///< Subscriber id on DependencySyncBus
+	bool LiteSynced; ///< true once SyncOI() has synced all udi to DGlite, later calls sync the changed udi only
+	unsigned long SyncVersion; ///< DependencyDataStore::version of SmartDG_GlobalData::GlobalPackage at the last Sync in (0 : full Sync in)
+	unsigned long SolverVersion; ///< DependencyDataBuffer::version of DG->Values at the end of the last solve; a mismatch at the next menu event means another View (sharing DG->Values) changed data and clears SolverContext
+	deque<DependencyMenuHandle> MenuHandles; ///< User data of Edit menu items (deque keeps their addresses stable)
+	bool EditsOpen; ///< true between BeginEdits() and CommitEdits()
+	vector<unsigned int> Edits; ///< DG->DOI.I indices set by SetEdit() since BeginEdits()
+	vector<GUINode> Widgets; ///< FLTK graphic objects of every DependencyNode in DG->DN (same index)
+	vector<GUIConnection*> Connections; ///< GUIConnection object of every Dependency object (indexed by Dependency::id, NULL : not displayed)
+	DependencyContext Context; ///< Menu context and the visibility and editability flags of every DG->DOI.I entry
 
 	// Static menu callback functions and their non-static carry-forwards
 	//////////////////////////////////////////////////
@@ -111,6 +133,8 @@ private:
 	///		- DGMonitor / Environment / SmartConnectors\n
 	///		- DGMonitor / Environment / All\n
 	///		- DGMonitor / Print Screen\n
+	///		- DGMonitor / Trace\n
+	///		- DGMonitor / Solver Stats\n
 	///		- DGMonitor / Sync / Allow\n
 	///		- DGMonitor / Sync / Block\n
 	///		- DGMonitor / Exit\n
@@ -123,9 +147,7 @@ private:
 	///		- Business\n
 	///		- Business / Forward\n
 	///		- Business / Reverse\n
-	///		- Edit\n
-	///		- Edit / "DependencyObject object's all or specific instance" / true\n
-	///		- Edit / "DependencyObject object's all or specific instance" / false\n
+	///		- Edit (dispatched by DependencyMonitor::Static_EditMenuBar_Callback())\n
 	///		- Sync\n
 	///		- Sync / Refresh\n
 	///		- Sync / Attach\n
@@ -169,29 +191,69 @@ private:
 	//////////////////////////////////////////////////
 	void MTWindowMenuBar_Callback();
 	//////////////////////////////////////////////////
+	/// \fn static void Static_EditMenuBar_Callback(Fl_Widget*WIDGET, void*DATA)
+	/// \brief Static callback function for Edit items of DependencyMonitor::MonitorWindowMenuBar (Fl_Menu_Bar *)
+	/// \param WIDGET	Fl_Widget* locating the Fl_Menu_Bar
+	/// \param DATA		DependencyMenuHandle* registered with the menu item
+	///
+	/// - Calls DependencyMonitor::EditMenuBar_Callback() of DependencyMenuHandle::monitor
+	///
+	/// \see void EditMenuBar_Callback(const DependencyMenuHandle &h)
+	//////////////////////////////////////////////////
+	static void Static_EditMenuBar_Callback(Fl_Widget*WIDGET, void*DATA) {
+		DependencyMenuHandle *TMP = (DependencyMenuHandle*) DATA;
+		TMP->monitor->EditMenuBar_Callback(*TMP);
+	}
+	//////////////////////////////////////////////////
+	/// \fn void EditMenuBar_Callback(const DependencyMenuHandle &h)
+	/// \brief Callback function for Edit items of DependencyMonitor::MonitorWindowMenuBar (Fl_Menu_Bar *)
+	/// \param [in] h is the DependencyMenuHandle registered with the selected menu item
+	///
+	/// - Edit / "DependencyObject object's all or specific instance" / true\n
+	/// - Edit / "DependencyObject object's all or specific instance" / false
+	///
+	/// \see static void Static_EditMenuBar_Callback(Fl_Widget*WIDGET, void*DATA)
+	/// \see void SetEdit(unsigned int doiindex, bool value, bool all = false)
+	//////////////////////////////////////////////////
+	void EditMenuBar_Callback(const DependencyMenuHandle &h);
+	//////////////////////////////////////////////////
 	/// \fn static void Static_NodeMenuBar_Callback(Fl_Widget*WIDGET, void*DATA)
-	/// \brief Static callback function for DependencyNode::BarIn and DependencyNode::BarOut (Fl_Menu_Bar *) of DependencyNode objects
+	/// \brief Static callback function for GUINode::BarIn and GUINode::BarOut (Fl_Menu_Bar *) of DependencyNode objects
 	/// \param WIDGET	Fl_Widget* locating the Fl_Menu_Bar
-	/// \param DATA		Data associated with the Fl_Menu_Bar object
+	/// \param DATA		DependencyMenuHandle* registered with the menu item
 	///
-	/// - Calls DependencyMonitor::NodeMenuBar_Callback()
+	/// - Resets the selection of the Fl_Menu_Bar\n
+	/// - Calls DependencyMonitor::NodeMenuBar_Callback() of DependencyMenuHandle::monitor
 	///
-	/// \see void NodeMenuBar_Callback()
+	/// \see void NodeMenuBar_Callback(const DependencyMenuHandle &h)
 	//////////////////////////////////////////////////
 	static void Static_NodeMenuBar_Callback(Fl_Widget*WIDGET, void*DATA) {
-		DependencyMonitor *TMP = (DependencyMonitor*) DATA;
-		TMP->NodeMenuBar_Callback();
+		DependencyMenuHandle *TMP = (DependencyMenuHandle*) DATA;
+		((Fl_Menu_Bar*) WIDGET)->value(0);
+		TMP->monitor->NodeMenuBar_Callback(*TMP);
 	}
 	//////////////////////////////////////////////////
-	/// \fn void NodeMenuBar_Callback
-	/// \brief Callback function for DependencyNode::BarIn and DependencyNode::BarOut (Fl_Menu_Bar *) of DependencyNode objects
+	/// \fn void NodeMenuBar_Callback(const DependencyMenuHandle &h)
+	/// \brief Callback function for GUINode::BarIn and GUINode::BarOut (Fl_Menu_Bar *) of DependencyNode objects
+	/// \param [in] h is the DependencyMenuHandle registered with the selected menu item
 	///
-	/// - Identifies selected option from the DependencyNode::BarIn and DependencyNode::BarOut menu bars\n
-	/// - Edit DependencyObject object's all or specific instance as true/false
+	/// - Edit DependencyObject object's all or specific instance as true/false\n
+	/// - Ignored unless the DependencyObjectInstance belongs to the current View (or Component) and Business direction
 	///
 	/// \see static void Static_NodeMenuBar_Callback(Fl_Widget*WIDGET, void*DATA)
+	/// \see void SetEdit(unsigned int doiindex, bool value, bool all = false)
+	//////////////////////////////////////////////////
+	void NodeMenuBar_Callback(const DependencyMenuHandle &h);
 	//////////////////////////////////////////////////
-	void NodeMenuBar_Callback();
+	/// \fn DependencyMenuHandle *MenuHandle(unsigned int doiindex, bool all, bool value)
+	/// \brief Creates a DependencyMenuHandle owned by DependencyMonitor::MenuHandles
+	/// \param [in] doiindex is DependencyMenuHandle::doiindex
+	/// \param [in] all is DependencyMenuHandle::all
+	/// \param [in] value is DependencyMenuHandle::value
+	/// \return DependencyMenuHandle* to be registered as user data of an Edit menu item
+	//////////////////////////////////////////////////
+	DependencyMenuHandle *MenuHandle(unsigned int doiindex, bool all,
+			bool value);
 	//////////////////////////////////////////////////
 	/// \fn void setup()
 	/// \brief setup operations right after a DependencyMonitor object is constructed
@@ -206,12 +268,17 @@ private:
 	///	\see DependencyMonitor()
 	///	\see DependencyMonitor(string GraphAndMonitorName, string mode)
 	///	\see DependencyMonitor(string MonitorName, string GraphName, string ViewName, string mode)
-	///	\see DependencyMonitor(DependencyMonitor from, string MonitorName, string GraphName, string ViewName, string mode)
+	///	\see DependencyMonitor(const DependencyMonitor &from, string MonitorName, string GraphName, string ViewName, string mode)
 	//////////////////////////////////////////////////
 	void setup();
 	//////////////////////////////////////////////////
 	/// \fn void makelitejs()
 	/// \brief Creates Java Script file in DGlite directory  (In all except DependencyMonitor::Mode : SmartDG_COMPONENT_DEVELOPER_MODE)
+	///
+	/// - The generated ViewDG() asks DependencyLiteServer for the entries changed since the
+	/// version it applied last and applies them\n
+	/// - Gets all entries again when the server was restarted
+	///
 	//////////////////////////////////////////////////
 	void makelitejs();
 	//////////////////////////////////////////////////
@@ -226,13 +293,55 @@ private:
 	//////////////////////////////////////////////////
 	void InitMT();
 	//////////////////////////////////////////////////
-	/// \fn SyncOI()
-	/// \brief Part of Sync mechanism, Sync out | Pause | Sync in
+	/// \fn SyncOI(const vector<unsigned int> &doiindices)
+	/// \brief Part of Sync mechanism, called after every local change (or batch of changes)
+	/// \param [in] doiindices are indices for the edited DependencyObjectInstance objects
+	///
+	/// - Calls SyncPublish(const vector<unsigned int> &ids) with SyncIds(doiindices)\n
+	/// - Calls SyncOutLite(const vector<unsigned int> &ids, bool useglobal) with the same ids for DGlite\n
+	/// - Other Views apply the change with SyncPoll() (no pause, no full copy)
 	///
 	/// \see void SyncOut()  \see void SyncIn()
 	/// \see void SyncOutLiteInit() \see void SyncOutLite(bool useglobal = true) \see void SyncInLite()
 	//////////////////////////////////////////////////
-	void SyncOI();
+	void SyncOI(const vector<unsigned int> &doiindices);
+	//////////////////////////////////////////////////
+	/// \fn vector<unsigned int> SyncIds(const vector<unsigned int> &doiindices)
+	/// \brief Part of Sync mechanism, lists the udi changed by the last edits and solve
+	/// \param [in] doiindices are indices for the edited DependencyObjectInstance objects
+	/// \return sorted value ids of all udi of the edited DependencyObjects and the value ids listed in DG->Changes
+	//////////////////////////////////////////////////
+	vector<unsigned int> SyncIds(const vector<unsigned int> &doiindices);
+	//////////////////////////////////////////////////
+	/// \fn SyncPublish(const vector<unsigned int> &ids)
+	/// \brief Part of Sync mechanism, publishes udi on DependencySyncBus
+	/// \param [in] ids are the value ids of the udi (SyncIds())
+	///
+	/// - Events carry the GlobalPackage URL ids (DependencyGraph::SyncFrom, SyncTo) instead of URL strings
+	///
+	/// \see void SyncPoll()
+	//////////////////////////////////////////////////
+	void SyncPublish(const vector<unsigned int> &ids);
+	//////////////////////////////////////////////////
+	/// \fn SyncPoll()
+	/// \brief Part of Sync mechanism, applies events published by other Views on DependencySyncBus
+	///
+	/// - Called at the beginning of every menu event\n
+	/// - Events made in DG->Values itself (shared Values) are skipped\n
+	/// - Calls SyncIn() if events were dropped before this View saw them
+	///
+	/// \see void SyncPublish(const vector<unsigned int> &ids)
+	//////////////////////////////////////////////////
+	void SyncPoll();
+	//////////////////////////////////////////////////
+	/// \fn SyncKeys()
+	/// \brief Part of Sync mechanism, interns the URLs of all DG->DOI.I entries in SmartDG_GlobalData::GlobalPackage
+	///
+	/// - Fills DependencyGraph::SyncFrom, SyncTo, SyncIndex, LiteKeys and LiteAllKeys of DG (once for all
+	/// DependencyMonitor objects sharing DG)
+	///
+	//////////////////////////////////////////////////
+	void SyncKeys();
 	//////////////////////////////////////////////////
 	/// \fn SyncOut()
 	/// \brief Part of Sync mechanism, Sync out
@@ -245,6 +354,9 @@ private:
 	/// \fn SyncIn()
 	/// \brief Part of Sync mechanism, Sync in
 	///
+	/// - Applies the SmartDG_GlobalData::GlobalPackage entries changed since SyncVersion
+	/// (DependencyDataStore::Since()); set SyncVersion to 0 for a full Sync in
+	///
 	/// \see void SyncOI() \see void SyncOut()
 	/// \see void SyncOutLiteInit() \see void SyncOutLite(bool useglobal = true) \see void SyncInLite()
 	//////////////////////////////////////////////////
@@ -264,13 +376,27 @@ private:
 	/// \param [in] useglobal is a boolean variable indicating if local (false) or global (true, Default)
 	/// version of data should Sync to DGlite
 	///
-	/// - Default value for useglobal is true i.e the Sync is done using Global Sync data (SmartDG_GlobalData::GlobalPackage)
+	/// - Default value for useglobal is true i.e the Sync is done using Global Sync data (SmartDG_GlobalData::GlobalPackage)\n
+	/// - Calls SyncOutLite(const vector<unsigned int> &ids, bool useglobal) for all udi
 	///
 	/// \see void SyncOI() \see void SyncOut()  \see void SyncIn()
 	/// \see void SyncOutLiteInit() \see void SyncInLite()
 	//////////////////////////////////////////////////
 	void SyncOutLite(bool useglobal = true);
 	//////////////////////////////////////////////////
+	/// \fn SyncOutLite(const vector<unsigned int> &ids, bool useglobal = true)
+	/// \brief Part of Sync mechanism for DGlite ( Web Browser View ) Sync out of some udi
+	///
+	/// \param [in] ids are the value ids of the udi
+	/// \param [in] useglobal is a boolean variable indicating if local (false) or global (true, Default)
+	/// version of data should Sync to DGlite
+	///
+	/// - Sets the DGlite entries of the udi and the Bias of their DependencyObjects only\n
+	/// - Publishes all entries of SmartDG_GlobalData::GlobalPackageLite at once (DependencyLiteSnapshot::Publish())
+	///
+	//////////////////////////////////////////////////
+	void SyncOutLite(const vector<unsigned int> &ids, bool useglobal = true);
+	//////////////////////////////////////////////////
 	/// \fn SyncInLite()
 	/// \brief Part of Sync mechanism for DGlite ( Web Browser View ) Sync in
 	///
@@ -353,10 +479,10 @@ private:
 	void RefreshMonitor();
 	//////////////////////////////////////////////////
 	/// \fn ResetDOIFlags(bool b = false, unsigned int c = 0)
-	/// \brief Resets DependencyObjectInstance::visible DependencyObjectInstance::editable flags
+	/// \brief Resets DependencyContext::visible DependencyContext::editable flags
 	/// \param [in] b is the value to be set to flags (Default : false)
 	/// \param [in] c is the choice of flag to be set (Default : 0)
-	/// (0: both, 1: DependencyObjectInstance::visible, 2: DependencyObjectInstance::editable)
+	/// (0: both, 1: DependencyContext::visible, 2: DependencyContext::editable)
 	///
 	/// - DOIFlags : DependencyObjectInstances Flags\n
 	/// - Default value for b is false\n
@@ -370,7 +496,7 @@ private:
 	void ResetDOIFlags(bool b = false, unsigned int c = 0);
 	//////////////////////////////////////////////////
 	/// \fn RefreshDOIFlags(string v = "ALL", string n = "ALL", string i = "ALL", string p = "ALL", string o = "ALL", bool b = false, unsigned int c =	0)
-	/// \brief Resets DependencyObjectInstance::visible DependencyObjectInstance::editable flags for given context
+	/// \brief Resets DependencyContext::visible DependencyContext::editable flags for given context
 	/// \param [in] v is context selector string for DependencyObjectInstances::ViewContext (Default : "ALL")
 	/// \param [in] n is context selector string for DependencyObjectInstances::NodeContext (Default : "ALL")
 	/// \param [in] i is context selector string for DependencyObjectInstances::IOContext (Default : "ALL")
@@ -378,7 +504,7 @@ private:
 	/// \param [in] o is context selector string for DependencyObjectInstances::ObjectContext (Default : "ALL")
 	/// \param [in] b is the value to be set to flags (Default : false)
 	/// \param [in] c is the choice of flag to be set (Default : 0)
-	/// (0: both, 1: DependencyObjectInstance::visible, 2: DependencyObjectInstance::editable)
+	/// (0: both, 1: DependencyContext::visible, 2: DependencyContext::editable)
 	///
 	/// - DOIFlags : DependencyObjectInstances Flags\n
 	/// - Default value for v is "ALL"\n
@@ -399,7 +525,7 @@ private:
 					0);
 	//////////////////////////////////////////////////
 	/// \fn RefreshDOIFlagsHierarchy(string v = "ALL", string n = "ALL", string i = "ALL", string p = "ALL", string o = "ALL", bool b = false, unsigned int c =	0)
-	/// \brief Resets DependencyObjectInstance::visible DependencyObjectInstance::editable flags for given context Hierarchically
+	/// \brief Resets DependencyContext::visible DependencyContext::editable flags for given context Hierarchically
 	/// \param [in] v is context selector string for DependencyObjectInstances::ViewContext (Default : "ALL")
 	/// \param [in] n is context selector string for DependencyObjectInstances::NodeContext (Default : "ALL")
 	/// \param [in] i is context selector string for DependencyObjectInstances::IOContext (Default : "ALL")
@@ -407,7 +533,7 @@ private:
 	/// \param [in] o is context selector string for DependencyObjectInstances::ObjectContext (Default : "ALL")
 	/// \param [in] b is the value to be set to flags (Default : false)
 	/// \param [in] c is the choice of flag to be set (Default : 0)
-	/// (0: both, 1: DependencyObjectInstance::visible, 2: DependencyObjectInstance::editable)
+	/// (0: both, 1: DependencyContext::visible, 2: DependencyContext::editable)
 	///
 	/// - DOIFlags : DependencyObjectInstances Flags\n
 	/// - Default value for v is "ALL"\n
@@ -428,11 +554,11 @@ private:
 			unsigned int c = 0);
 	//////////////////////////////////////////////////
 	/// \fn RefreshDOIFlagsURL(string u, bool b = false, unsigned int c = 0)
-	/// \brief Resets DependencyObjectInstance::visible DependencyObjectInstance::editable flags for all instances under a URL / DependencyObject
+	/// \brief Resets DependencyContext::visible DependencyContext::editable flags for all instances under a URL / DependencyObject
 	/// \param [in] u is URL of the DependencyObject object, flags of all instances of which will be set
 	/// \param [in] b is the value to be set to flags (Default : false)
 	/// \param [in] c is the choice of flag to be set (Default : 0)
-	/// (0: both, 1: DependencyObjectInstance::visible, 2: DependencyObjectInstance::editable)
+	/// (0: both, 1: DependencyContext::visible, 2: DependencyContext::editable)
 	///
 	/// - DOIFlags : DependencyObjectInstances Flags\n
 	/// - Default value for b is false\n
@@ -446,11 +572,11 @@ private:
 	void RefreshDOIFlagsURL(string u, bool b = false, unsigned int c = 0);
 	//////////////////////////////////////////////////
 	/// \fn RefreshDOIFlagsMenuIDString(string m, bool b = false, unsigned int c =	0)
-	/// \brief Resets DependencyObjectInstance::visible DependencyObjectInstance::editable flags for given Menu identifier string
+	/// \brief Resets DependencyContext::visible DependencyContext::editable flags for given Menu identifier string
 	/// \param [in] m is Menu identifier string of the DependencyObject object instance, flags of all instances of which will be set
 	/// \param [in] b is the value to be set to flags (Default : false)
 	/// \param [in] c is the choice of flag to be set (Default : 0)
-	/// (0: both, 1: DependencyObjectInstance::visible, 2: DependencyObjectInstance::editable)
+	/// (0: both, 1: DependencyContext::visible, 2: DependencyContext::editable)
 	///
 	/// - DOIFlags : DependencyObjectInstances Flags\n
 	/// - Default value for b is false\n
@@ -465,13 +591,13 @@ private:
 			0);
 	//////////////////////////////////////////////////
 	/// \fn RefreshEditMenu()
-	/// \brief Refresh Edit menu according to  DependencyObjectInstance::editable flags
+	/// \brief Refresh Edit menu according to  DependencyContext::editable flags
 	/// \see ShowHideMonitorWindowMenuBar(string item, bool flag)
 	//////////////////////////////////////////////////
 	void RefreshEditMenu();
 	//////////////////////////////////////////////////
 	/// \fn ShowHideMonitorWindowMenuBar(string item, bool flag)
-	/// \brief Refresh Edit menu according to  DependencyObjectInstance::editable flags
+	/// \brief Refresh Edit menu according to  DependencyContext::editable flags
 	/// \param [in] item is Menu identifier string of the item to be set
 	/// \param [in] flag is the value to be set to the item
 	/// \see RefreshEditMenu()
@@ -479,13 +605,13 @@ private:
 	void ShowHideMonitorWindowMenuBar(string item, bool flag);
 	//////////////////////////////////////////////////
 	/// \fn RefreshNodeEditMenu()
-	/// \brief Refresh Node Edit menu according to  DependencyObjectInstance::editable flags
+	/// \brief Refresh Node Edit menu according to  DependencyContext::editable flags
 	/// \see ShowHideNodeMenuBar(unsigned int tog, string item, bool b)
 	//////////////////////////////////////////////////
 	void RefreshNodeEditMenu();
 	//////////////////////////////////////////////////
 	/// \fn ShowHideNodeMenuBar(unsigned int tog, string item, bool b)
-	/// \brief Refresh Node Edit menu according to  DependencyObjectInstance::editable flags
+	/// \brief Refresh Node Edit menu according to  DependencyContext::editable flags
 	/// \param [in] tog is Input/Output Node Edit menu selector (0: Input Node Edit menu, 1: Output Node Edit menu)
 	/// \param [in] item is Menu identifier string of the item to be set
 	/// \param [in] b is the value to be set to the item
@@ -494,7 +620,7 @@ private:
 	void ShowHideNodeMenuBar(unsigned int tog, string item, bool b);
 	//////////////////////////////////////////////////
 	/// \fn MenuJointRefresh()
-	/// \brief Refresh Edit menu and Node Edit menus according to  DependencyObjectInstance::editable flags
+	/// \brief Refresh Edit menu and Node Edit menus according to  DependencyContext::editable flags
 	/// \see RefreshEditMenu() \see RefreshNodeEditMenu()
 	//////////////////////////////////////////////////
 	void MenuJointRefresh();
@@ -547,20 +673,61 @@ private:
 	//////////////////////////////////////////////////
 	void GenDispStr();
 	//////////////////////////////////////////////////
+	/// \fn InitWidgets()
+	/// \brief Sizes the per DependencyMonitor GUI data to DG
+	///
+	/// - Fills Widgets with a GUINode object for every DependencyNode in DG->DN\n
+	/// - Sets all Connections to NULL\n
+	/// - Attaches Context to DG->DOI
+	///
+	//////////////////////////////////////////////////
+	void InitWidgets();
+	//////////////////////////////////////////////////
 	/// \fn Solver(unsigned int doiindex)
 	/// \brief Solves the DependencyGraph data by calling appropriate transfer/inverse transfer
 	/// functions for DependencyNodes and Connectors
 	/// \param [in] doiindex is index for DependencyObjectInstance object, the node where a smart Solver may start
-	/// \todo Improve Solver ALgorithm
+	///
+	/// In SmartDG_OBJECT_MODE a worklist of dirty Connectors and DependencyNodes is propagated:\n
+	/// - Seeds the DependencyNode of the edited DependencyObjectInstance and all Connectors of
+	/// the current View touching it (everything is seeded if SolverContext does not match)\n
+	/// - Calls DependencyGraph::Solve() with this DependencyMonitor as DependencyGraphObserver\n
+	/// - Sets SolverContext when the worklist was emptied\n
+	/// - Resets SolverStats, Solved() merges DG->Stats of every solve
+	///
+	/// In SmartDG_COMPONENT_MODE the Connectors around the edited DependencyNode are called directly
+	/// and DG->Changes and DG->Stats record the changes and calls.
 	/// \todo Replace DependencyMonitor::Solver with a public function pointer
 	/// that gets assigned outside SmartDG library
 	//////////////////////////////////////////////////
 	void Solver(unsigned int doiindex);
+	//////////////////////////////////////////////////
+	/// \fn Solver(const vector<unsigned int> &doiindices)
+	/// \brief Solves the DependencyGraph data once for a batch of edits
+	/// \param [in] doiindices are indices for the edited DependencyObjectInstance objects
+	///
+	/// - Seeds the DependencyNodes of all edited DependencyObjectInstance objects (grouped by View)
+	/// and runs one worklist per View\n
+	/// - Calls SyncOI() once for the whole batch
+	///
+	/// \see Solver(unsigned int doiindex)
+	//////////////////////////////////////////////////
+	void Solver(const vector<unsigned int> &doiindices);
 public:
 	string Name; ///< Name given to uniquely identify a DependencyMonitor object.
-	DependencyGraph DG; ///< A DependencyGraph object that models dependency graph associated with the current DependencyGraph object
+	//////////////////////////////////////////////////
+	/// \var DG
+	/// \brief Points to the DependencyGraph object that models the dependency graph displayed by the DependencyMonitor
+	///
+	/// The DependencyGraph (DependencyNode topology, View, DOI and its indexes, SCC, URL tables and
+	/// Values) is built once by SmartDGGenerator and shared by all DependencyMonitor objects of a
+	/// system. FLTK graphic objects (Widgets, Connections) and the menu context (Context) are kept
+	/// per DependencyMonitor.
+	//////////////////////////////////////////////////
+	shared_ptr<DependencyGraph> DG;
 	string Mode; ///< A string that stores the current Mode of operation (SmartDG_OBJECT_MODE or SmartDG_COMPONENT_MODE or SmartDG_COMPONENT_DEVELOPER_MODE)
 	string DisplayMode; ///< A string that stores the current Mode of display (SmartDG_FLTK_DISPLAYMODE or SmartDG_LITE_DISPLAYMODE or SmartDG_DUAL_DISPLAYMODE)
+	DependencySolveStats SolverStats; ///< Performance counters of the last Solver() call or Solve() (shown on the status line, DGMonitor/Solver Stats prints them as JSON)
 
 	//////////////////////////////////////////////////
 	/// \fn DependencyMonitor()
@@ -571,7 +738,7 @@ public:
 	///
 	///	\see DependencyMonitor(string GraphAndMonitorName, string mode)
 	///	\see DependencyMonitor(string MonitorName, string GraphName, string ViewName, string mode)
-	///	\see DependencyMonitor(DependencyMonitor from, string MonitorName, string GraphName, string ViewName, string mode)
+	///	\see DependencyMonitor(const DependencyMonitor &from, string MonitorName, string GraphName, string ViewName, string mode)
 	//////////////////////////////////////////////////
 	DependencyMonitor();
 	//////////////////////////////////////////////////
@@ -583,7 +750,7 @@ public:
 	///
 	///	\see DependencyMonitor()
 	///	\see DependencyMonitor(string MonitorName, string GraphName, string ViewName, string mode)
-	///	\see DependencyMonitor(DependencyMonitor from, string MonitorName, string GraphName, string ViewName, string mode)
+	///	\see DependencyMonitor(const DependencyMonitor &from, string MonitorName, string GraphName, string ViewName, string mode)
 	//////////////////////////////////////////////////
 	DependencyMonitor(string GraphAndMonitorName, string mode);
 	//////////////////////////////////////////////////
@@ -595,23 +762,23 @@ public:
 	///
 	///	\see DependencyMonitor()
 	///	\see DependencyMonitor(string GraphAndMonitorName, string mode)
-	///	\see DependencyMonitor(DependencyMonitor from, string MonitorName, string GraphName, string ViewName, string mode)
+	///	\see DependencyMonitor(const DependencyMonitor &from, string MonitorName, string GraphName, string ViewName, string mode)
 	//////////////////////////////////////////////////
 	DependencyMonitor(string MonitorName, string GraphName, string ViewName,
 			string mode);
 	//////////////////////////////////////////////////
-	/// \fn DependencyMonitor(DependencyMonitor from, string MonitorName, string GraphName, string ViewName, string mode)
-	/// \brief Constructor that fills [DG], [Name], [DG.Name], [currentView or currentComponent] and [Mode] from user arguments
+	/// \fn DependencyMonitor(const DependencyMonitor &from, string MonitorName, string GraphName, string ViewName, string mode)
+	/// \brief Constructor that shares [DG] and fills [Name], [currentView or currentComponent] and [Mode] from user arguments
 	///
 	/// - Initializes data\n
 	/// - Calls DependencyMonitor::setup()\n
-	/// - Copies from.DG --> DG
+	/// - Shares from.DG (GraphName is the name of from.DG)
 	///
 	///	\see DependencyMonitor()
 	///	\see DependencyMonitor(string GraphAndMonitorName, string mode)
 	///	\see DependencyMonitor(string MonitorName, string GraphName, string ViewName, string mode)
 	//////////////////////////////////////////////////
-	DependencyMonitor(DependencyMonitor from, string MonitorName,
+	DependencyMonitor(const DependencyMonitor &from, string MonitorName,
 			string GraphName, string ViewName, string mode);
 	//////////////////////////////////////////////////
 	/// \fn void Init()
@@ -643,10 +810,94 @@ public:
 	/// \param displaymode is SmartDG_FLTK_DISPLAYMODE or SmartDG_LITE_DISPLAYMODE or SmartDG_DUAL_DISPLAYMODE (default)
 	///
 	/// - Shows GUI\n
+	/// - Starts DependencyLiteServer on the DGlite directory for SmartDG_LITE_DISPLAYMODE and
+	/// SmartDG_DUAL_DISPLAYMODE (stopped by the destructor)\n
 	/// - Default value for displaymode argument is SmartDG_DUAL_DISPLAYMODE
 	///
 	//////////////////////////////////////////////////
 	void Show(string displaymode = SmartDG_DUAL_DISPLAYMODE);
+	//////////////////////////////////////////////////
+	/// \fn void BeginEdits()
+	/// \brief Opens a batch of edits
+	///
+	/// - Calls SyncPoll()\n
+	/// - Edits made with SetEdit() are solved, Synced and refreshed once by CommitEdits()
+	///
+	/// \see void SetEdit(unsigned int doiindex, bool value, bool all = false) \see void CommitEdits()
+	//////////////////////////////////////////////////
+	void BeginEdits();
+	//////////////////////////////////////////////////
+	/// \fn void SetEdit(unsigned int doiindex, bool value, bool all = false)
+	/// \brief Sets the value of a DependencyObjectInstance object
+	/// \param [in] doiindex is index for the DependencyObjectInstance object in DG->DOI.I
+	/// \param [in] value is the value set
+	/// \param [in] all sets all udi of the DependencyObject when true, the udi only when false (default)
+	///
+	/// - Between BeginEdits() and CommitEdits() only the value is set\n
+	/// - Otherwise the edit is a batch of one (solved, Synced and refreshed right away)
+	///
+	/// \see void BeginEdits() \see void CommitEdits()
+	//////////////////////////////////////////////////
+	void SetEdit(unsigned int doiindex, bool value, bool all = false);
+	//////////////////////////////////////////////////
+	/// \fn const DependencySolveStats& CommitEdits()
+	/// \brief Closes a batch of edits
+	/// \return SolverStats of the batch
+	///
+	/// - Calls Solver(const vector<unsigned int> &doiindices) once for all edits (one solve and one Sync)\n
+	/// - Calls RefreshMonitorData() once and updates the status line
+	///
+	/// \see void BeginEdits() \see void SetEdit(unsigned int doiindex, bool value, bool all = false)
+	//////////////////////////////////////////////////
+	const DependencySolveStats& CommitEdits();
+	//////////////////////////////////////////////////
+	/// \fn bool Solve(int direction = 1)
+	/// \brief Solves the current View headless (without GUI refresh and Sync)
+	/// \param direction is 1 for transfer functions (TF) and -1 for inverse transfer functions (FT)
+	/// \return [bool] true if the View converged, false on breakout or when not in SmartDG_OBJECT_MODE
+	///
+	/// - Calls Solve(int direction, DependencyDataBuffer &values) on DG->Values
+	///
+	/// \see SmartDGGenerator::SolveAll(int direction = 1, unsigned int threads = 0)
+	//////////////////////////////////////////////////
+	bool Solve(int direction = 1);
+	//////////////////////////////////////////////////
+	/// \fn bool Solve(int direction, DependencyDataBuffer &values)
+	/// \brief Solves the current View headless on the given values (without GUI refresh and Sync)
+	/// \param direction is 1 for transfer functions (TF) and -1 for inverse transfer functions (FT)
+	/// \param values is DG->Values or a buffer of the same layout (e.g. a copy of it)
+	/// \return [bool] true if the View converged, false on breakout or when not in SmartDG_OBJECT_MODE
+	///
+	/// - Calls DependencyGraph::Solve(string obj, int direction, DependencyDataBuffer &values, DependencyDataChanges &changes, DependencySolveStats &stats)
+	/// (no observer, no trace, no GUI)\n
+	/// - Sets SolverContext when converged and SolverStats\n
+	/// - Writes only values and this DependencyMonitor (SolverContext, SolverStats), so that
+	/// DependencyMonitor objects of different Views sharing DG may solve concurrently on buffers of their own
+	///
+	/// \see SmartDGGenerator::SolveAll(int direction = 1, unsigned int threads = 0)
+	//////////////////////////////////////////////////
+	bool Solve(int direction, DependencyDataBuffer &values);
+	//////////////////////////////////////////////////
+	/// \fn void SolvedConnector(Dependency &d, int direction, bool changed)
+	/// \brief DependencyGraphObserver event: Records a SmartDG_TRACE_EVENT_CONNECTOR in DependencyTrace
+	//////////////////////////////////////////////////
+	void SolvedConnector(Dependency &d, int direction, bool changed);
+	//////////////////////////////////////////////////
+	/// \fn void SolvedNode(DependencyNode &n, int direction, bool changed)
+	/// \brief DependencyGraphObserver event: Records a SmartDG_TRACE_EVENT_NODE in DependencyTrace
+	//////////////////////////////////////////////////
+	void SolvedNode(DependencyNode &n, int direction, bool changed);
+	//////////////////////////////////////////////////
+	/// \fn void Solved(DependencyGraph &G, string obj, int direction, bool converged)
+	/// \brief DependencyGraphObserver event: Applies the solve to the GUI
+	///
+	/// - Calls GUIConnection::setDirection() with Dependency::direction for all Connectors of the
+	/// View that were called (and have a GUIConnection)\n
+	/// - Records a SmartDG_TRACE_EVENT_SOLVED (DependencyDataChanges::count of G.Changes) in DependencyTrace\n
+	/// - Merges G.Stats into SolverStats
+	///
+	//////////////////////////////////////////////////
+	void Solved(DependencyGraph &G, string obj, int direction, bool converged);
 
 	virtual ~DependencyMonitor();
 };
@@ -19,20 +19,10 @@ namespace SmartDG {
 
 DependencyNode::DependencyNode() {
 	Name = "NA_DN";
-	setNULL();
 }
 
 DependencyNode::DependencyNode(std::string NodeName) {
 	Name = NodeName;
-	setNULL();
-}
-
-void DependencyNode::setNULL() {
-	Shape = NULL;
-	ShapeI = NULL;
-	ShapeO = NULL;
-	BarIn = NULL;
-	BarOut = NULL;
 }
 
 void DependencyNode::Generate_DP() {
@@ -45,6 +35,27 @@ void DependencyNode::Generate_DP() {
 	DP_Out.clear();
 }
 
+bool DependencyNode::Bind() {
+	// DependencyNode::Handles is filled from DependencyNode::TFT.Bindings ("IO.Port.Obj")
+	TransferFunctionHelper H;
+	bool bound = true;
+	Handles.assign(TFT.Bindings.size(), URL());
+	for (unsigned int i = 0; i < TFT.Bindings.size(); i++) {
+		string b = TFT.Bindings[i];
+		size_t first = b.find('.');
+		size_t last = b.rfind('.');
+		if ((first == string::npos) || (first == last)
+				|| !H.Bind(DP, b.substr(0, first),
+						b.substr(first + 1, last - first - 1),
+						b.substr(last + 1), Handles[i])) {
+			cout << "ERROR[TF HANDLE NOT BOUND]: DependencyNode " << Name
+					<< " <" << b << ">" << endl;
+			bound = false;
+		}
+	}
+	return bound;
+}
+
 void DependencyNode::Display() {
 	// Displays all DependencyPort objects in DependencyNode and their DependencyObject objects
 	// Input Port
@@ -18,19 +18,14 @@
 
 #include "SmartDG.h"
 
-///> Smart Transfer/InverseTransfer Function Pointer Type
-typedef void (*SFPT)(string, vector<string>&,
-		vector<vector<SmartDG::DependencyPort> >&);
-///> A string map from DependencyNode::Name string to associated SFPT (Smart Transfer/InverseTransfer Function Pointer Type)
-typedef std::unordered_map<std::string, SFPT> SmartDG__map;
-
 namespace SmartDG {
 ////////////////////////////////////////////////////////////////////////////////
 ///	\class DependencyNode
 /// \brief DependencyNode class models a Node in the DependencyGraph
 ///
 /// This class encapsulates DependencyPort objects representing various Input and Output
-/// ports of the component. The class also manages FLTK graphic objects to populate the GUI.
+/// ports of the component. The FLTK graphic objects of a DependencyNode are held per
+/// DependencyMonitor by GUINode.
 ////////////////////////////////////////////////////////////////////////////////
 class DependencyNode {
 public:
@@ -44,14 +39,10 @@ public:
 	///
 	//////////////////////////////////////////////////
 	string isInstanceOf;
-	SFPT TFT; ///< Smart Transfer/InverseTransfer Function Pointer Type that gets assigned outside SmartDG library
+	DependencyComponent TFT; ///< Transfer/InverseTransfer functions (typed or SFPT) that get assigned outside SmartDG library
+	vector<URL> Handles; ///< Index URLs into DependencyNode::DP of TFT.Bindings, filled by DependencyNode::Bind()
 	unsigned int x;	///< Stores x coordinate of location where FLTK elements associated with DependencyNode objects are initiated
 	unsigned int y;	///< Stores y coordinate of location where FLTK elements associated with DependencyNode objects are initiated
-	Fl_Group *Shape;///< Points to Fl_Group object that encapsulates all FLTK elements associated with DependencyNode object
-	Fl_Group *ShapeI;///< Points to Fl_Group object that encapsulates all FLTK elements associated with Input DependencyPort objects
-	Fl_Group *ShapeO;///< Points to Fl_Group object that encapsulates all FLTK elements associated with Output DependencyPort objects
-	Fl_Menu_Bar *BarIn;	///< Points to Fl_Menu_Bar object that handles Node Edit menu associated with Input DependencyPorts
-	Fl_Menu_Bar *BarOut;///< Points to Fl_Menu_Bar object that handles Node Edit menu associated with Output DependencyPorts
 	//////////////////////////////////////////////////
 	/// \var DP_In
 	/// \brief A vector of input DependencyPort objects
@@ -92,37 +83,21 @@ public:
 	/// \fn DependencyNode()
 	/// \brief Constructor
 	///
-	/// - Sets Default DependencyNode::Name\n
-	/// - Calls DependencyNode::setNULL()
+	/// - Sets Default DependencyNode::Name
 	///
-	/// \see DependencyNode(string NodeName) \see setNULL()
+	/// \see DependencyNode(string NodeName)
 	//////////////////////////////////////////////////
 	DependencyNode();
 	//////////////////////////////////////////////////
 	/// \fn DependencyNode(string NodeName)
 	/// \brief Constructor
 	///
-	/// - Sets DependencyNode::Name : argument NodeName\n
-	/// - Calls DependencyNode::setNULL()
+	/// - Sets DependencyNode::Name : argument NodeName
 	///
-	/// \see DependencyNode() \see setNULL()
+	/// \see DependencyNode()
 	//////////////////////////////////////////////////
 	DependencyNode(string NodeName);
 	//////////////////////////////////////////////////
-	/// \fn setNULL()
-	/// \brief Called by Constructors, Sets FLTK graphic object pointers to NULL
-	///
-	/// - Called by all Constructors
-	/// - Sets DependencyNode::Shape  : NULL\n
-	/// - Sets DependencyNode::ShapeI : NULL\n
-	/// - Sets DependencyNode::ShapeO : NULL\n
-	/// - Sets DependencyNode::BarIn  : NULL\n
-	/// - Sets DependencyNode::BarOut : NULL
-	///
-	/// \see DependencyNode() \see DependencyNode(string NodeName)
-	//////////////////////////////////////////////////
-	void setNULL();
-	//////////////////////////////////////////////////
 	/// \var Generate_DP()
 	/// \brief Fills DependencyNode::DP from DependencyNode::DP_In and DependencyNode::DP_Out
 	///
@@ -137,6 +112,18 @@ public:
 	//////////////////////////////////////////////////
 	void Generate_DP();
 	//////////////////////////////////////////////////
+	/// \fn bool Bind()
+	/// \brief Fills DependencyNode::Handles from DependencyNode::TFT.Bindings
+	/// \return false if a binding is malformed or names no DependencyObject in DependencyNode::DP
+	///
+	/// - Called once at graph build, after DependencyNode::TFT is assigned
+	/// - Handles[i] is the index URL (InOutIndex, PortIndex, ObjectIndex) of TFT.Bindings[i] in DP
+	/// - Index URLs stay valid in copies of the DependencyNode (DP keeps its layout)
+	///
+	/// \see TransferFunctionHelper::Bind()
+	//////////////////////////////////////////////////
+	bool Bind();
+	//////////////////////////////////////////////////
 	/// \fn Display()
 	/// \brief Displays all DependencyPort objects in DependencyNode and their DependencyObject objects
 	/// \see Display_URLs()
@@ -28,42 +28,89 @@ DependencyObject::DependencyObject(string DOName) {
 }
 
 void DependencyObject::setup() {
-	Shape = NULL;
+	udb = NULL;
+}
+
+void DependencyObject::AddInstance(string instance, unsigned int id) {
+	// Keeps udk sorted
+	vector<string>::iterator it = lower_bound(udk.begin(), udk.end(),
+			instance);
+	unsigned int k = it - udk.begin();
+	// Rebinds value id in case udi already exists
+	if ((it != udk.end()) && (*it == instance)) {
+		udv[k] = id;
+		return;
+	}
+	udk.insert(it, instance);
+	udv.insert(udv.begin() + k, id);
+}
+
+int DependencyObject::Find(string instance) {
+	vector<string>::iterator it = lower_bound(udk.begin(), udk.end(),
+			instance);
+	if ((it == udk.end()) || (*it != instance))
+		return -1;
+	return it - udk.begin();
+}
+
+DependencyDataBuffer* DependencyObject::Buffer() {
+	return (bound != NULL) ? bound : udb;
+}
+
+unsigned int DependencyObject::Instances() {
+	return udk.size();
 }
 
 void DependencyObject::Set(DependencyDataPackage d, string instance) {
-	udi[instance] = d;
+	int k = Find(instance);
+	DependencyDataBuffer *b = Buffer();
+	// Does nothing when instance is not found
+	if ((k < 0) || (b == NULL))
+		return;
+	// Sets through DependencyDataBuffer::Set() so that changes are marked in DependencyDataBuffer::changed
+	b->Set(udv[k], d);
 }
 
 void DependencyObject::Set(DependencyDataPackage d) {
-	for (map<string, DependencyDataPackage>::const_iterator it = udi.begin();
-			it != udi.end(); ++it)
-		udi[it->first] = d;
+	DependencyDataBuffer *b = Buffer();
+	if (b == NULL)
+		return;
+	for (unsigned int k = 0; k < udv.size(); k++)
+		b->Set(udv[k], d);
 }
 
 DependencyDataPackage DependencyObject::Get(string instance) {
-	return udi[instance];
+	int k = Find(instance);
+	DependencyDataBuffer *b = Buffer();
+	// Returns default DependencyDataPackage when instance is not found
+	if ((k < 0) || (b == NULL))
+		return DependencyDataPackage();
+	return b->Get(udv[k]);
 }
 
 DependencyDataPackage DependencyObject::Get() {
+	DependencyDataBuffer *b = Buffer();
+	// Returns default DependencyDataPackage when there are no udi entries
+	if ((udv.size() == 0) || (b == NULL))
+		return DependencyDataPackage();
 	// Returns DependencyDataPackage get value of the first udi entry irrespective of number of udi entries
-	map<string, DependencyDataPackage>::const_iterator it = udi.begin();
-	return udi[it->first];
+	return b->Get(udv[0]);
 }
 
 int DependencyObject::GetBias() {
-	double tot = 0;
-	for (map<string, DependencyDataPackage>::const_iterator it = udi.begin();
-			it != udi.end(); ++it)
-		if (it->second.b)
-			tot++;
-	if (udi.size() == 0)
-		return -1; // Returns -1 when there are no udi entries
+	DependencyDataBuffer *b = Buffer();
+	// Returns -1 when there are no udi entries
+	if ((udv.size() == 0) || (b == NULL))
+		return -1;
+	double tot = b->Count(udv);
 	// Returns round ( ((Number of true values in udi entries) / (total number of udi entries)) * 10 )
-	return round((tot / udi.size()) * 10);
+	return round((tot / udv.size()) * 10);
 }
 
 DependencyObject::~DependencyObject() {
 }
 
+// Buffer bound to the current thread by DependencyGraph::Solve() (NULL : DependencyObject::udb)
+thread_local DependencyDataBuffer *DependencyObject::bound = NULL;
+
 } /* namespace SmartDG */
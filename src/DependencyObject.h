@@ -23,17 +23,19 @@ namespace SmartDG {
 ///	\class DependencyObject
 /// \brief DependencyObject class models a Dependency object in the DependencyGraph
 ///
-/// This class encapsulates DependencyDataPackage objects for all instances of DependencyObject.
-/// The class also manages FLTK graphic objects to populate the GUI.
+/// This class indexes values of all instances of DependencyObject, which are stored in the
+/// DependencyDataBuffer of the parent DependencyGraph.
+/// The FLTK graphic objects of a DependencyObject are held per DependencyMonitor by GUINode.
 ////////////////////////////////////////////////////////////////////////////////
 class DependencyObject {
 public:
 	string Name; ///< Name given to uniquely identify a DependencyObject object
 	URL url;	///< URL object to uniquely identify a DependencyObject object
 	DependencyDataPackage defaultdata; ///< Default data object for DependencyDataPackage associated with Unique Dependency Instances (udi)
-	map<string, DependencyDataPackage> udi;	///< Dependency Object's Unique Dependency Instance mapped through URL::str of correspondent as the key
-	map<string, GUIConnection*> udiShape;///< Points to GUIConnection object used to populate Unique Dependency Instance in GUI.
-	Fl_Group *Shape;///< Points to Fl_Group object used to group all FLTK graphic elements associated with DependencyObject object.
+	DependencyDataBuffer *udb;	///< Points to DependencyDataBuffer holding values of Dependency Object's Unique Dependency Instances (udi)
+	static thread_local DependencyDataBuffer *bound;	///< Buffer used instead of udb on the current thread while DependencyGraph::Solve() solves on another buffer (NULL : udb)
+	vector<string> udk;	///< URL::str of correspondent for every udi (sorted, used as key)
+	vector<unsigned int> udv;	///< Value id in DependencyObject::udb for every udi (parallel to DependencyObject::udk)
 	//////////////////////////////////////////////////
 	/// \fn DependencyObject()
 	/// \brief Constructor
@@ -56,19 +58,52 @@ public:
 	DependencyObject(string DOName);
 	//////////////////////////////////////////////////
 	/// \fn setup()
-	/// \brief Called by Constructors, Sets FLTK graphic object pointers to NULL
+	/// \brief Called by Constructors, Sets DependencyObject::udb to NULL
 	///
 	/// - Called by all Constructors\n
-	/// - Sets DependencyNode::Shape  : NULL
+	/// - Sets DependencyObject::udb  : NULL
 	///
 	/// \see DependencyObject() \see DependencyObject(string DOName)
 	//////////////////////////////////////////////////
 	void setup();
 	//////////////////////////////////////////////////
+	/// \fn AddInstance(string instance, unsigned int id)
+	/// \brief Adds a udi (Dependency Object's Unique Dependency Instance)
+	/// \param [in] instance is URL::str of correspondent
+	/// \param [in] id is value id of the udi in DependencyObject::udb
+	///
+	/// - Keeps DependencyObject::udk sorted\n
+	/// - Rebinds value id in case udi already exists
+	///
+	//////////////////////////////////////////////////
+	void AddInstance(string instance, unsigned int id);
+	//////////////////////////////////////////////////
+	/// \fn DependencyDataBuffer* Buffer()
+	/// \brief Returns the buffer holding the udi values on the current thread
+	/// \return DependencyObject::bound if set, DependencyObject::udb otherwise
+	//////////////////////////////////////////////////
+	DependencyDataBuffer* Buffer();
+	//////////////////////////////////////////////////
+	/// \fn Find(string instance)
+	/// \brief Finds a udi (Dependency Object's Unique Dependency Instance)
+	/// \param [in] instance is URL::str of correspondent
+	/// \return [int] index in DependencyObject::udk and DependencyObject::udv, -1 if not found
+	//////////////////////////////////////////////////
+	int Find(string instance);
+	//////////////////////////////////////////////////
+	/// \fn Instances()
+	/// \brief Returns number of udi entries
+	//////////////////////////////////////////////////
+	unsigned int Instances();
+	//////////////////////////////////////////////////
 	/// \fn Set(DependencyDataPackage d, string instance)
 	/// \brief Setter function for udi (Dependency Object's Unique Dependency Instances)
 	/// \param [in] d is the DependencyDataPackage object to be set to udi
 	/// \param [in] instance is the udi to be set
+	///
+	/// - Sets through DependencyDataBuffer::Set() so that changes are marked in DependencyDataBuffer::changed\n
+	/// - Does nothing when instance is not found
+	///
 	/// \see Set(DependencyDataPackage d)
 	/// \see Get(string instance) \see Get()
 	//////////////////////////////////////////////////
@@ -77,6 +112,9 @@ public:
 	/// \fn Set(DependencyDataPackage d)
 	/// \brief Setter function for udi (Dependency Object's Unique Dependency Instances)
 	/// \param [in] d is the DependencyDataPackage object to be set to all udi entries
+	///
+	/// - Sets through DependencyDataBuffer::Set() so that changes are marked in DependencyDataBuffer::changed
+	///
 	/// \see Set(DependencyDataPackage d, string instance)
 	/// \see Get(string instance) \see Get()
 	//////////////////////////////////////////////////
@@ -86,6 +124,9 @@ public:
 	/// \brief Getter function for udi (Dependency Object's Unique Dependency Instances)
 	/// \param [in] instance is the udi to be get
 	/// \return DependencyDataPackage get value
+	///
+	/// - Returns a default DependencyDataPackage when instance is not found
+	///
 	/// \see Set(DependencyDataPackage d, string instance) \see Set(DependencyDataPackage d)
 	/// \see Get()
 	//////////////////////////////////////////////////
@@ -95,7 +136,8 @@ public:
 	/// \brief Getter function for udi (Dependency Object's Unique Dependency Instances)
 	/// \return DependencyDataPackage get value
 	///
-	/// - Returns DependencyDataPackage get value of the first udi entry irrespective of number of udi entries
+	/// - Returns DependencyDataPackage get value of the first udi entry irrespective of number of udi entries\n
+	/// - Returns a default DependencyDataPackage when there are no udi entries
 	///
 	/// \see Set(DependencyDataPackage d, string instance) \see Set(DependencyDataPackage d)
 	/// \see Get(string instance)
@@ -18,47 +18,24 @@
 namespace SmartDG {
 
 DependencyObjectInstance::DependencyObjectInstance(unsigned long i, URL p,
-		URL t, int d) {
+		URL t, int d, unsigned int v) {
 	id = i;
-	obj = p.stro;
+	obj = p.stro();
 	direction = d;
 	pou = p;
 	tou = t;
-	cuk = t.str;
-	mid = p.strp + "/" + obj + "[" + cuk + "]";
-	midL = p.strn + "/" + p.strio + "/" + mid;
-	amid = p.strp + "/" + obj + "[ALL]";
-	amidL = p.strn + "/" + p.strio + "/" + amid;
-	visible = false;
-	editable = false;
+	cuk = t.str();
+	vid = v;
+	mid = p.strp() + "/" + obj + "[" + cuk + "]";
+	midL = p.strn() + "/" + p.strio() + "/" + mid;
+	amid = p.strp() + "/" + obj + "[ALL]";
+	amidL = p.strn() + "/" + p.strio() + "/" + amid;
 }
 
-void DependencyObjectInstance::Display() {
+void DependencyObjectInstance::Display() const {
 	// Displays DependencyObjectInstance object
-	cout << "DependencyObjectInstance:[" << id << "] " << obj << " " << pou.str
-			<< " " << tou.str << " " << cuk << " " << endl;
-}
-
-void DependencyObjectInstance::DisplayIf(unsigned int c) {
-	// Condition based Displays DependencyObjectInstance object
-	// c is condition selector on visible and editable flags
-	switch (c) {
-	// Display if both flags are true
-	case 0:
-		if (visible && editable)
-			Display();
-		break;
-		// Display if DependencyObjectInstance::visible is true
-	case 1:
-		if (visible)
-			Display();
-		break;
-		// Display if DependencyObjectInstance::editable is true
-	case 2:
-		if (editable)
-			Display();
-		break;
-	}
+	cout << "DependencyObjectInstance:[" << id << "] " << obj << " " << pou.str()
+			<< " " << tou.str() << " " << cuk << " " << endl;
 }
 
 DependencyObjectInstance::~DependencyObjectInstance() {
@@ -24,8 +24,8 @@ namespace SmartDG {
 /// \brief DependencyObjectInstance class models Dependency Object's Unique Dependency Instance
 ///
 /// This class encapsulates unique integer id, source DependencyObject name, data flow direction,
-/// parent and corresponding DependencyObject URL objects. GUI menu bar strings and flags associated
-/// with menu visibility and editability for DependencyObjectInstance are also stored in this class.
+/// parent and corresponding DependencyObject URL objects. GUI menu bar strings for DependencyObjectInstance
+/// are also stored in this class (menu visibility and editability are kept per DependencyMonitor by DependencyContext).
 ////////////////////////////////////////////////////////////////////////////////
 class DependencyObjectInstance {
 public:
@@ -35,50 +35,36 @@ public:
 	URL pou; ///< Parent Object URL
 	URL tou; ///< Corresponding Object URL
 	string cuk; ///< Corresponding udi key
+	unsigned int vid; ///< Value id of the udi in DependencyDataBuffer of the parent DependencyGraph
 	string mid; ///< Menu ID String
 	string midL; ///< Menu ID String Long
 	string amid; ///< Menu ID String (for all instances)
 	string amidL; ///< Menu ID String Long (for all instances)
-	bool editable; ///< Menu edit enabling flag
-	bool visible; ///< Menu display enabling flag
 	//////////////////////////////////////////////////
-	/// \fn DependencyObjectInstance(unsigned long i, URL p, URL t, int d)
+	/// \fn DependencyObjectInstance(unsigned long i, URL p, URL t, int d, unsigned int v)
 	/// \brief Constructor
 	///
 	/// - Sets DependencyObjectInstance::id : i\n
-	/// - Sets DependencyObjectInstance::obj : p.stro\n
+	/// - Sets DependencyObjectInstance::obj : p.stro()\n
 	/// - Sets DependencyObjectInstance::direction : d\n
 	/// - Sets DependencyObjectInstance::pou : p\n
 	/// - Sets DependencyObjectInstance::tou : t\n
-	/// - Sets DependencyObjectInstance::cuk : t.str\n
+	/// - Sets DependencyObjectInstance::cuk : t.str()\n
+	/// - Sets DependencyObjectInstance::vid : v\n
 	/// - Sets Default value for DependencyObjectInstance::mid\n
 	/// - Sets Default value for DependencyObjectInstance::midL\n
 	/// - Sets Default value for DependencyObjectInstance::amid\n
-	/// - Sets Default value for DependencyObjectInstance::amidL\n
-	/// - Sets Default value for DependencyObjectInstance::editable\n
-	/// - Sets Default value for DependencyObjectInstance::visible
+	/// - Sets Default value for DependencyObjectInstance::amidL
 	///
 	//////////////////////////////////////////////////
-	DependencyObjectInstance(unsigned long i, URL p, URL t, int d);
+	DependencyObjectInstance(unsigned long i, URL p, URL t, int d,
+			unsigned int v);
 	//////////////////////////////////////////////////
 	/// \fn Display()
 	/// \brief Displays DependencyObjectInstance object
-	/// \see DisplayIf(unsigned int c=0)
+	/// \see DependencyContext::DisplayIf(unsigned int c=0)
 	//////////////////////////////////////////////////
-	void Display();
-	//////////////////////////////////////////////////
-	/// \fn DisplayIf(unsigned int c=0)
-	/// \brief Condition based Displays DependencyObjectInstance object
-	/// \param c is condition selector on DependencyObjectInstance::visible and
-	/// DependencyObjectInstance::editable flags
-	///
-	/// - c : 0 : Display if both flags are true\n
-	/// - c : 1 : Display if DependencyObjectInstance::visible is true\n
-	/// - c : 2 : Display if DependencyObjectInstance::editable is true
-	///
-	/// \see Display()
-	//////////////////////////////////////////////////
-	void DisplayIf(unsigned int c = 0);
+	void Display() const;
 	virtual ~DependencyObjectInstance();
 };
 
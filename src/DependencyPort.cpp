@@ -20,15 +20,11 @@ namespace SmartDG {
 DependencyPort::DependencyPort() {
 	// Sets Default Name
 	Name = "NA_DP";
-	// Calls setNULL()
-	setNULL();
 }
 
 DependencyPort::DependencyPort(string DPName) {
 	// Sets Name : DPName
 	Name = DPName;
-	// Calls setNULL()
-	setNULL();
 }
 
 DependencyPort::DependencyPort(const SmartDG::DependencyPort& dp) {
@@ -37,13 +33,6 @@ DependencyPort::DependencyPort(const SmartDG::DependencyPort& dp) {
 	Name = dp.Name;
 	// Sets DO : dp.DO
 	DO = dp.DO;
-	// Calls setNULL()
-	setNULL();
-}
-
-void DependencyPort::setNULL() {
-	// sets FLTK graphic pointers to NULL
-	Shape = NULL;
 }
 
 DependencyPort::~DependencyPort() {
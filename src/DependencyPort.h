@@ -30,16 +30,14 @@ namespace SmartDG {
 class DependencyPort {
 public:
 	string Name; ///< Name given to uniquely identify a DependencyPort object
-	Fl_Group *Shape; ///< Points to Fl_Group object that encapsulates all FLTK elements associated with DependencyPort object
 	vector<DependencyObject> DO; ///< a vector of DependencyObject objects that are available at DependencyPort
 	//////////////////////////////////////////////////
 	/// \fn DependencyPort()
 	/// \brief Constructor
 	///
-	/// - Sets Default DependencyPort::Name\n
-	/// - Calls DependencyPort::setNULL()
+	/// - Sets Default DependencyPort::Name
 	///
-	/// \see DependencyPort(string DPName) \see DependencyPort(const SmartDG::DependencyPort& dp) \see setNULL()
+	/// \see DependencyPort(string DPName) \see DependencyPort(const SmartDG::DependencyPort& dp)
 	//////////////////////////////////////////////////
 	DependencyPort();
 	//////////////////////////////////////////////////
@@ -47,10 +45,9 @@ public:
 	/// \brief Constructor
 	///	\param [in] DPName is string argument used to set DependencyPort::Name
 	///
-	/// - Sets DependencyPort::Name : DPName\n
-	/// - Calls DependencyPort::setNULL()
+	/// - Sets DependencyPort::Name : DPName
 	///
-	/// \see DependencyPort() \see DependencyPort(const SmartDG::DependencyPort& dp) \see setNULL()
+	/// \see DependencyPort() \see DependencyPort(const SmartDG::DependencyPort& dp)
 	//////////////////////////////////////////////////
 	DependencyPort(string DPName);
 	//////////////////////////////////////////////////
@@ -59,22 +56,12 @@ public:
 	///	\param [in, out] dp is DependencyPort argument used to set DependencyPort (Copy Constructor)
 	///
 	/// - Sets DependencyPort::Name : dp.Name\n
-	/// - Sets DependencyPort::DO : dp.DO\n
-	/// - Calls DependencyPort::setNULL()
+	/// - Sets DependencyPort::DO : dp.DO
 	///
-	/// \see DependencyPort() \see DependencyPort(string DPName) \see setNULL()
+	/// \see DependencyPort() \see DependencyPort(string DPName)
 	//////////////////////////////////////////////////
 	DependencyPort(const SmartDG::DependencyPort& dp);
 	//////////////////////////////////////////////////
-	/// \fn setNULL()
-	/// \brief Called by all Constructors, sets FLTK graphic pointers to NULL
-	///
-	/// - sets FLTK graphic pointers to NULL
-	///
-	/// \see DependencyPort() \see DependencyPort(string DPName) \see DependencyPort(const SmartDG::DependencyPort& dp)
-	//////////////////////////////////////////////////
-	void setNULL();
-	//////////////////////////////////////////////////
 	/// \fn ~DependencyPort()
 	/// \brief Default Destructor
 	//////////////////////////////////////////////////
@@ -0,0 +1,157 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencySolveStats.cpp
+/// \brief	Source file for DependencySolveStats class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+
+DependencySolveStats::DependencySolveStats() {
+	Reset();
+}
+
+void DependencySolveStats::Reset(string obj, int dir) {
+	view = obj;
+	direction = dir;
+	converged = true;
+	solves = 0;
+	passes = 0;
+	breakouts = 0;
+	changes = 0;
+	connectorCalls = 0;
+	connectorChanges = 0;
+	nodeCalls = 0;
+	nodeChanges = 0;
+	time = 0;
+	connectorCount.clear();
+	nodeCount.clear();
+	nodeTime.clear();
+}
+
+void DependencySolveStats::CountConnector(unsigned int id, bool changed) {
+	if (id >= connectorCount.size())
+		connectorCount.resize(id + 1, 0);
+	connectorCount[id]++;
+	connectorCalls++;
+	if (changed)
+		connectorChanges++;
+}
+
+void DependencySolveStats::CountNode(unsigned int j, bool changed,
+		double seconds) {
+	if (j >= nodeCount.size()) {
+		nodeCount.resize(j + 1, 0);
+		nodeTime.resize(j + 1, 0);
+	}
+	nodeCount[j]++;
+	nodeTime[j] += seconds;
+	nodeCalls++;
+	if (changed)
+		nodeChanges++;
+}
+
+void DependencySolveStats::Merge(const DependencySolveStats &s) {
+	// Views and directions of the first solve are kept as long as all solves agree
+	if (solves == 0) {
+		view = s.view;
+		direction = s.direction;
+	} else {
+		if (view != s.view)
+			view = "";
+		if (direction != s.direction)
+			direction = 0;
+	}
+	converged = converged && s.converged;
+	solves += s.solves;
+	passes = max(passes, s.passes);
+	breakouts += s.breakouts;
+	changes += s.changes;
+	connectorCalls += s.connectorCalls;
+	connectorChanges += s.connectorChanges;
+	nodeCalls += s.nodeCalls;
+	nodeChanges += s.nodeChanges;
+	time += s.time;
+	if (s.connectorCount.size() > connectorCount.size())
+		connectorCount.resize(s.connectorCount.size(), 0);
+	for (unsigned int i = 0; i < s.connectorCount.size(); i++)
+		connectorCount[i] += s.connectorCount[i];
+	if (s.nodeCount.size() > nodeCount.size()) {
+		nodeCount.resize(s.nodeCount.size(), 0);
+		nodeTime.resize(s.nodeCount.size(), 0);
+	}
+	for (unsigned int j = 0; j < s.nodeCount.size(); j++) {
+		nodeCount[j] += s.nodeCount[j];
+		nodeTime[j] += s.nodeTime[j];
+	}
+}
+
+string DependencySolveStats::str() const {
+	// passes | Connector calls | Component calls | changes | time
+	stringstream ss;
+	ss << passes << " passes, " << connectorCalls << "+" << nodeCalls
+			<< " calls, " << changes << " changes, " << fixed
+			<< setprecision(3) << time * 1000 << " ms";
+	if (!converged)
+		ss << ", NOT CONVERGED";
+	return ss.str();
+}
+
+string DependencySolveStats::JSON(DependencyGraph *G) const {
+	stringstream ss;
+	ss << "{\"view\":\"" << DependencyJSON::Escape(view)
+			<< "\",\"direction\":" << direction << ",\"converged\":"
+			<< (converged ? "true" : "false") << ",\"solves\":" << solves
+			<< ",\"passes\":" << passes << ",\"breakouts\":" << breakouts
+			<< ",\"changes\":" << changes << ",\"connectorCalls\":"
+			<< connectorCalls << ",\"connectorChanges\":" << connectorChanges
+			<< ",\"nodeCalls\":" << nodeCalls << ",\"nodeChanges\":"
+			<< nodeChanges << ",\"time\":" << time;
+	// Connector (by Dependency::id) : Source DependencyNode - DependencyObject - Target DependencyNode
+	ss << ",\"connectors\":{";
+	bool first = true;
+	for (unsigned int i = 0; i < connectorCount.size(); i++) {
+		if (connectorCount[i] == 0)
+			continue;
+		ss << (first ? "" : ",") << "\"" << i << "\":{";
+		if ((G != NULL) && (2 * i < G->DOI.vi.size())) {
+			DependencyObjectInstance &oi = G->DOI.I[G->DOI.vi[2 * i]];
+			ss << "\"name\":\""
+					<< DependencyJSON::Escape(
+							oi.pou.strn() + "-" + oi.pou.stro() + "-"
+									+ oi.tou.strn()) << "\",";
+		}
+		ss << "\"calls\":" << connectorCount[i] << "}";
+		first = false;
+	}
+	// DependencyNode : calls and cumulative time
+	ss << "},\"nodes\":{";
+	first = true;
+	for (unsigned int j = 0; j < nodeCount.size(); j++) {
+		if (nodeCount[j] == 0)
+			continue;
+		string name = to_string(j);
+		if ((G != NULL) && (j < G->DN.size()))
+			name = G->DN[j].Name;
+		ss << (first ? "" : ",") << "\"" << DependencyJSON::Escape(name)
+				<< "\":{\"calls\":" << nodeCount[j];
+		if (SmartDG_SOLVE_NODE_TIMING)
+			ss << ",\"time\":" << nodeTime[j];
+		ss << "}";
+		first = false;
+	}
+	ss << "}}";
+	return ss.str();
+}
+
+} /* namespace SmartDG */
@@ -0,0 +1,100 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencySolveStats.h
+/// \brief	Header file for DependencySolveStats class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DEPENDENCYSOLVESTATS_H_
+#define DEPENDENCYSOLVESTATS_H_
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+class DependencyGraph;
+////////////////////////////////////////////////////////////////////////////////
+///	\class DependencySolveStats
+/// \brief DependencySolveStats class holds the performance counters of a solve
+///
+/// DependencyGraph::Solve() fills DependencyGraph::Stats, DependencyMonitor::SolverStats merges
+/// the solves of one DependencyMonitor::Solver() call.
+/// str() is a one line summary (status line), JSON() is machine-readable.
+////////////////////////////////////////////////////////////////////////////////
+class DependencySolveStats {
+public:
+	string view; ///< DependencyObject name of the View solved (empty when several Views were merged)
+	int direction; ///< 1 for TF, -1 for FT
+	bool converged; ///< false if SmartDG_CIRCULAR_DEPENDENCY_BREAKOUT_COUNT was reached
+	unsigned int solves; ///< Number of solves counted (merged)
+	unsigned int passes; ///< Passes over the View (SolvePasses) or over the slowest SCC (SolveTopological)
+	unsigned int breakouts; ///< Number of times SmartDG_CIRCULAR_DEPENDENCY_BREAKOUT_COUNT was reached
+	unsigned long changes; ///< Values changed (DependencyDataChanges::count)
+	unsigned long connectorCalls; ///< Connector TF/FT calls
+	unsigned long connectorChanges; ///< Connector TF/FT calls that changed a value
+	unsigned long nodeCalls; ///< Component TF/FT calls
+	unsigned long nodeChanges; ///< Component TF/FT calls that changed a value
+	double time; ///< Wall time of the solve(s) in seconds
+	vector<unsigned long> connectorCount; ///< TF/FT calls per Connector, indexed by Dependency::id
+	vector<unsigned long> nodeCount; ///< TF/FT calls per DependencyNode, indexed like DependencyGraph::DN
+	vector<double> nodeTime; ///< Cumulative time of DependencyNode::TFT calls in seconds, indexed like DependencyGraph::DN (0 unless SmartDG_SOLVE_NODE_TIMING)
+	//////////////////////////////////////////////////
+	/// \fn DependencySolveStats()
+	/// \brief Constructor, calls Reset()
+	//////////////////////////////////////////////////
+	DependencySolveStats();
+	//////////////////////////////////////////////////
+	/// \fn void Reset(string obj = "", int dir = 0)
+	/// \brief Zeroes all counters (converged : true)
+	/// \param [in] obj is DependencyObject name of the View
+	/// \param [in] dir is 1 for TF and -1 for FT
+	//////////////////////////////////////////////////
+	void Reset(string obj = "", int dir = 0);
+	//////////////////////////////////////////////////
+	/// \fn void CountConnector(unsigned int id, bool changed)
+	/// \brief Counts a Connector TF/FT call
+	/// \param [in] id is Dependency::id of the Connector
+	/// \param [in] changed is true if the call changed a value
+	//////////////////////////////////////////////////
+	void CountConnector(unsigned int id, bool changed);
+	//////////////////////////////////////////////////
+	/// \fn void CountNode(unsigned int j, bool changed, double seconds)
+	/// \brief Counts a Component TF/FT call
+	/// \param [in] j is index of the DependencyNode in DependencyGraph::DN
+	/// \param [in] changed is true if the call changed a value
+	/// \param [in] seconds is the time taken by the call (0 unless SmartDG_SOLVE_NODE_TIMING)
+	//////////////////////////////////////////////////
+	void CountNode(unsigned int j, bool changed, double seconds);
+	//////////////////////////////////////////////////
+	/// \fn void Merge(const DependencySolveStats &s)
+	/// \brief Adds the counters of s (view is cleared if it differs, passes is the maximum)
+	//////////////////////////////////////////////////
+	void Merge(const DependencySolveStats &s);
+	//////////////////////////////////////////////////
+	/// \fn string str() const
+	/// \brief Returns a one line summary
+	//////////////////////////////////////////////////
+	string str() const;
+	//////////////////////////////////////////////////
+	/// \fn string JSON(DependencyGraph *G = NULL) const
+	/// \brief Returns all counters as a JSON object
+	/// \param [in] G is used to add Connector names and to key DependencyNode entries by name instead of index (may be NULL)
+	///
+	/// - "connectors" is keyed by Dependency::id (Connector names are not unique), e.g. "12":{"name":"...","calls":3}
+	/// - Entries that were not called are left out of "connectors" and "nodes"
+	/// - Per DependencyNode "time" is only written if SmartDG_SOLVE_NODE_TIMING
+	///
+	//////////////////////////////////////////////////
+	string JSON(DependencyGraph *G = NULL) const;
+};
+
+} /* namespace SmartDG */
+
+#endif /* DEPENDENCYSOLVESTATS_H_ */
@@ -0,0 +1,86 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencySyncBus.cpp
+/// \brief	Source file for DependencySyncBus class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+
+unsigned int DependencySyncBus::Subscribe() {
+	lock_guard<mutex> guard(lock);
+	cursor.push_back(first + queue.size());
+	return cursor.size() - 1;
+}
+
+void DependencySyncBus::Unsubscribe(unsigned int subscriber) {
+	lock_guard<mutex> guard(lock);
+	if (subscriber >= cursor.size())
+		return;
+	// Events kept only for this subscriber are dropped
+	cursor[subscriber] = SmartDG_SYNC_UNSUBSCRIBED;
+	Trim();
+}
+
+void DependencySyncBus::Publish(vector<DependencySyncEvent> &events) {
+	lock_guard<mutex> guard(lock);
+	for (unsigned int e = 0; e < events.size(); e++) {
+		SmartDG_GlobalData::GlobalPackage.Set(events[e].from, events[e].to,
+				events[e].data);
+		queue.push_back(events[e]);
+	}
+	Trim();
+}
+
+bool DependencySyncBus::Poll(unsigned int subscriber,
+		vector<DependencySyncEvent> &events) {
+	lock_guard<mutex> guard(lock);
+	events.clear();
+	if ((subscriber >= cursor.size())
+			|| (cursor[subscriber] == SmartDG_SYNC_UNSUBSCRIBED))
+		return false;
+	// Events were dropped before the subscriber saw them
+	bool complete = (cursor[subscriber] >= first);
+	if (!complete)
+		cursor[subscriber] = first;
+	for (unsigned long s = cursor[subscriber]; s < first + queue.size(); s++)
+		events.push_back(queue[s - first]);
+	cursor[subscriber] = first + queue.size();
+	Trim();
+	return complete;
+}
+
+void DependencySyncBus::Trim() {
+	// Drops events seen by all subscribers (SmartDG_SYNC_UNSUBSCRIBED is never the minimum)
+	unsigned long seen = first + queue.size();
+	for (unsigned int c = 0; c < cursor.size(); c++)
+		seen = min(seen, cursor[c]);
+	// Bounds the queue
+	if (first + queue.size() - seen > SmartDG_SYNC_QUEUE_LIMIT)
+		seen = first + queue.size() - SmartDG_SYNC_QUEUE_LIMIT;
+	while (first < seen) {
+		queue.pop_front();
+		first++;
+	}
+}
+
+// Guards all static data members of DependencySyncBus
+mutex DependencySyncBus::lock;
+// Events not yet seen by all subscribers
+deque<DependencySyncEvent> DependencySyncBus::queue;
+// Sequence number of queue.front()
+unsigned long DependencySyncBus::first = 0;
+// Sequence number of the next event to be polled, for every subscriber
+vector<unsigned long> DependencySyncBus::cursor;
+
+} /* namespace SmartDG */
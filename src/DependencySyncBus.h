@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencySyncBus.h
+/// \brief	Header file for DependencySyncBus class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DEPENDENCYSYNCBUS_H_
+#define DEPENDENCYSYNCBUS_H_
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+////////////////////////////////////////////////////////////////////////////////
+///	\class DependencySyncBus
+/// \brief DependencySyncBus class is the publish/subscribe event queue for data Sync between Views
+///
+/// A View publishes only the udi its last edit and solve changed (DependencySyncEvent objects).
+/// Publish() appends them to a single queue and updates SmartDG_GlobalData::GlobalPackage.
+/// Every subscriber keeps a cursor into the queue and applies the events it has not seen yet
+/// with Poll(); events seen by all subscribers are dropped. The queue is bounded by
+/// SmartDG_SYNC_QUEUE_LIMIT: a subscriber that fell behind is told so by Poll() and falls back
+/// to a full Sync in from GlobalPackage.\n
+/// All members are static, so that Views of different SmartDGGenerator objects can sync too.
+////////////////////////////////////////////////////////////////////////////////
+class DependencySyncBus {
+private:
+	static mutex lock; ///< Guards all static data members
+	static deque<DependencySyncEvent> queue; ///< Events not yet seen by all subscribers
+	static unsigned long first; ///< Sequence number of queue.front()
+	static vector<unsigned long> cursor; ///< Sequence number of the next event to be polled, for every subscriber (SmartDG_SYNC_UNSUBSCRIBED once unsubscribed)
+	//////////////////////////////////////////////////
+	/// \fn void Trim()
+	/// \brief Drops events seen by all subscribers and events beyond SmartDG_SYNC_QUEUE_LIMIT (lock must be held)
+	//////////////////////////////////////////////////
+	static void Trim();
+public:
+	//////////////////////////////////////////////////
+	/// \fn unsigned int Subscribe()
+	/// \brief Adds a subscriber that receives all events published from now on
+	/// \return [unsigned int] subscriber id
+	//////////////////////////////////////////////////
+	static unsigned int Subscribe();
+	//////////////////////////////////////////////////
+	/// \fn void Unsubscribe(unsigned int subscriber)
+	/// \brief Removes a subscriber, events are no longer kept for it
+	/// \param [in] subscriber is the subscriber id returned by Subscribe()
+	///
+	/// - Subscriber ids are not reused, so that unsubscribing twice does no harm
+	///
+	//////////////////////////////////////////////////
+	static void Unsubscribe(unsigned int subscriber);
+	//////////////////////////////////////////////////
+	/// \fn void Publish(vector<DependencySyncEvent> &events)
+	/// \brief Publishes events
+	/// \param [in] events are the changed udi
+	///
+	/// - Sets the SmartDG_GlobalData::GlobalPackage entry (from, to) for every event\n
+	/// - Appends events to the queue
+	///
+	//////////////////////////////////////////////////
+	static void Publish(vector<DependencySyncEvent> &events);
+	//////////////////////////////////////////////////
+	/// \fn bool Poll(unsigned int subscriber, vector<DependencySyncEvent> &events)
+	/// \brief Returns the events published since the last call for a subscriber
+	/// \param [in] subscriber is the subscriber id returned by Subscribe()
+	/// \param [out] events are the events in the order they were published
+	/// \return [bool] false if events were dropped before the subscriber saw them (or the subscriber was removed)
+	//////////////////////////////////////////////////
+	static bool Poll(unsigned int subscriber,
+			vector<DependencySyncEvent> &events);
+};
+
+} /* namespace SmartDG */
+
+#endif /* DEPENDENCYSYNCBUS_H_ */
@@ -0,0 +1,39 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencySyncEvent.cpp
+/// \brief	Source file for DependencySyncEvent class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+
+DependencySyncEvent::DependencySyncEvent() {
+	vid = 0;
+	from = 0;
+	to = 0;
+	source = NULL;
+}
+
+DependencySyncEvent::DependencySyncEvent(unsigned int id, unsigned int f,
+		unsigned int t, DependencyDataPackage d, const DependencyDataBuffer *s) {
+	vid = id;
+	from = f;
+	to = t;
+	data = d;
+	source = s;
+}
+
+DependencySyncEvent::~DependencySyncEvent() {
+}
+
+} /* namespace SmartDG */
@@ -0,0 +1,54 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencySyncEvent.h
+/// \brief	Header file for DependencySyncEvent class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DEPENDENCYSYNCEVENT_H_
+#define DEPENDENCYSYNCEVENT_H_
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+////////////////////////////////////////////////////////////////////////////////
+///	\class DependencySyncEvent
+/// \brief DependencySyncEvent class carries one changed udi (Dependency Object's Unique Dependency Instance) between Views
+/// \see DependencySyncBus
+////////////////////////////////////////////////////////////////////////////////
+class DependencySyncEvent {
+public:
+	unsigned int vid; ///< Value id of the udi in DependencyGraph::Values (DependencyObjectInstance::vid)
+	unsigned int from; ///< URL id in SmartDG_GlobalData::GlobalPackage of the udi (DependencyObjectInstance::pou)
+	unsigned int to; ///< URL id in SmartDG_GlobalData::GlobalPackage of the correspondent (DependencyObjectInstance::tou)
+	DependencyDataPackage data; ///< New value of the udi
+	const DependencyDataBuffer *source; ///< DependencyDataBuffer the change was made in (Views sharing it skip the event)
+	//////////////////////////////////////////////////
+	/// \fn DependencySyncEvent()
+	/// \brief Constructor
+	//////////////////////////////////////////////////
+	DependencySyncEvent();
+	//////////////////////////////////////////////////
+	/// \fn DependencySyncEvent(unsigned int id, unsigned int f, unsigned int t, DependencyDataPackage d, const DependencyDataBuffer *s)
+	/// \brief Constructor that fills all members
+	//////////////////////////////////////////////////
+	DependencySyncEvent(unsigned int id, unsigned int f, unsigned int t,
+			DependencyDataPackage d, const DependencyDataBuffer *s);
+	//////////////////////////////////////////////////
+	/// \fn ~DependencySyncEvent()
+	/// \brief Default Destructor
+	//////////////////////////////////////////////////
+	virtual ~DependencySyncEvent();
+};
+
+} /* namespace SmartDG */
+
+#endif /* DEPENDENCYSYNCEVENT_H_ */
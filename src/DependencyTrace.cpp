@@ -0,0 +1,90 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyTrace.cpp
+/// \brief	Source file for DependencyTrace class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+
+void DependencyTrace::Record(int level, int kind, int direction,
+		unsigned int id, unsigned long value, bool flag) {
+	// Claims a slot, the oldest event is overwritten
+	unsigned long seq = next.fetch_add(1);
+	DependencyTraceEvent &e = ring[seq % SmartDG_TRACE_RING];
+	e.seq = seq;
+	e.level = level;
+	e.kind = kind;
+	e.direction = direction;
+	e.flag = flag;
+	e.id = id;
+	e.value = value;
+}
+
+vector<DependencyTraceEvent> DependencyTrace::Events() {
+	vector<DependencyTraceEvent> events;
+	unsigned long last = next.load();
+	unsigned long first = (last > SmartDG_TRACE_RING) ? last - SmartDG_TRACE_RING : 0;
+	for (unsigned long s = first; s < last; s++)
+		events.push_back(ring[s % SmartDG_TRACE_RING]);
+	return events;
+}
+
+void DependencyTrace::Dump(ostream &out, DependencyGraph *G) {
+	vector<DependencyTraceEvent> events = Events();
+	for (unsigned int i = 0; i < events.size(); i++) {
+		DependencyTraceEvent &e = events[i];
+		switch (e.kind) {
+		case SmartDG_TRACE_EVENT_SOLVE:
+			out << endl << "S	O	L	V	E	R	(" << e.id << ")" << endl;
+			break;
+		case SmartDG_TRACE_EVENT_CONNECTOR: {
+			// Connector : Source DependencyNode -> Target DependencyNode
+			string name = "{" + to_string(e.id) + "}";
+			if ((G != NULL) && (2 * e.id < G->DOI.vi.size())) {
+				DependencyObjectInstance &oi = G->DOI.I[G->DOI.vi[2 * e.id]];
+				name = oi.pou.strn() + "-" + oi.pou.stro() + "-"
+						+ oi.tou.strn();
+			}
+			out << ((e.direction < 0) ? "<<" : "") << name
+					<< ((e.direction > 0) ? ">>" : "") << (e.flag ? "* " : " ");
+			break;
+		}
+		case SmartDG_TRACE_EVENT_NODE: {
+			string name = "[" + to_string(e.id) + "]";
+			if ((G != NULL) && (e.id < G->DN.size()))
+				name = G->DN[e.id].Name;
+			out << name << ((e.direction > 0) ? "[>>]" : "[<<]")
+					<< (e.flag ? "* " : " ");
+			break;
+		}
+		case SmartDG_TRACE_EVENT_SOLVED:
+			out << endl << "DependencyDataChanges::count = " << e.value
+					<< (e.flag ? "" : " (not converged)") << endl;
+			break;
+		}
+	}
+}
+
+void DependencyTrace::Clear() {
+	next = 0;
+}
+
+// Last SmartDG_TRACE_RING events
+DependencyTraceEvent DependencyTrace::ring[SmartDG_TRACE_RING];
+// Sequence number of the next event
+atomic<unsigned long> DependencyTrace::next(0);
+// Run time trace level, events above it are not recorded
+int DependencyTrace::level = SmartDG_TRACE_LEVEL;
+
+} /* namespace SmartDG */
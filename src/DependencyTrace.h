@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyTrace.h
+/// \brief	Header file for DependencyTrace class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DEPENDENCYTRACE_H_
+#define DEPENDENCYTRACE_H_
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+class DependencyGraph;
+////////////////////////////////////////////////////////////////////////////////
+///	\class DependencyTrace
+/// \brief DependencyTrace class records solver trace events in a ring buffer
+///
+/// Events are written with the SmartDG_TRACE() macro, which records nothing unless the event level
+/// is compiled in (SmartDG_TRACE_LEVEL) and enabled at run time (DependencyTrace::level).
+/// With SmartDG_TRACE_LEVEL set to SmartDG_TRACE_OFF all trace code is compiled out.
+/// The last SmartDG_TRACE_RING events are kept as DependencyTraceEvent objects (no console I/O
+/// while solving) and are printed on demand with Dump().\n
+/// All members are static.
+////////////////////////////////////////////////////////////////////////////////
+class DependencyTrace {
+private:
+	static DependencyTraceEvent ring[SmartDG_TRACE_RING]; ///< Last SmartDG_TRACE_RING events
+	static atomic<unsigned long> next; ///< Sequence number of the next event
+public:
+	static int level; ///< Run time trace level, events above it are not recorded
+	//////////////////////////////////////////////////
+	/// \fn void Record(int level, int kind, int direction, unsigned int id, unsigned long value, bool flag)
+	/// \brief Records an event (use SmartDG_TRACE() instead)
+	//////////////////////////////////////////////////
+	static void Record(int level, int kind, int direction, unsigned int id,
+			unsigned long value, bool flag);
+	//////////////////////////////////////////////////
+	/// \fn vector<DependencyTraceEvent> Events()
+	/// \brief Returns the events kept in the ring buffer, oldest first
+	//////////////////////////////////////////////////
+	static vector<DependencyTraceEvent> Events();
+	//////////////////////////////////////////////////
+	/// \fn void Dump(ostream &out, DependencyGraph *G = NULL)
+	/// \brief Prints the events kept in the ring buffer, oldest first
+	/// \param [in] out is the stream printed to
+	/// \param [in] G is used to print Connector and DependencyNode names instead of ids (may be NULL)
+	//////////////////////////////////////////////////
+	static void Dump(ostream &out, DependencyGraph *G = NULL);
+	//////////////////////////////////////////////////
+	/// \fn void Clear()
+	/// \brief Drops all events
+	//////////////////////////////////////////////////
+	static void Clear();
+};
+
+} /* namespace SmartDG */
+
+#endif /* DEPENDENCYTRACE_H_ */
@@ -0,0 +1,30 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyTraceEvent.cpp
+/// \brief	Source file for DependencyTraceEvent class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+
+DependencyTraceEvent::DependencyTraceEvent() {
+	seq = 0;
+	level = SmartDG_TRACE_OFF;
+	kind = SmartDG_TRACE_EVENT_SOLVE;
+	direction = 0;
+	flag = false;
+	id = 0;
+	value = 0;
+}
+
+} /* namespace SmartDG */
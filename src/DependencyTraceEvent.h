@@ -0,0 +1,47 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	DependencyTraceEvent.h
+/// \brief	Header file for DependencyTraceEvent class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DEPENDENCYTRACEEVENT_H_
+#define DEPENDENCYTRACEEVENT_H_
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+////////////////////////////////////////////////////////////////////////////////
+///	\class DependencyTraceEvent
+/// \brief DependencyTraceEvent class is one fixed size (binary) entry of the DependencyTrace ring buffer
+///
+/// Plain data, recording an event copies no strings.
+/// \see DependencyTrace
+////////////////////////////////////////////////////////////////////////////////
+class DependencyTraceEvent {
+public:
+	unsigned long seq; ///< Sequence number of the event
+	unsigned char level; ///< Trace level (SmartDG_TRACE_SOLVER, SmartDG_TRACE_CALLS)
+	unsigned char kind; ///< SmartDG_TRACE_EVENT_SOLVE, SmartDG_TRACE_EVENT_CONNECTOR, SmartDG_TRACE_EVENT_NODE or SmartDG_TRACE_EVENT_SOLVED
+	signed char direction; ///< 1 for TF, -1 for FT
+	bool flag; ///< Connector or DependencyNode changed a value (converged for SmartDG_TRACE_EVENT_SOLVED)
+	unsigned int id; ///< Dependency::id of a Connector, index of a DependencyNode in DependencyGraph::DN, or number of edits solved
+	unsigned long value; ///< DependencyDataChanges::count for SmartDG_TRACE_EVENT_SOLVED
+	//////////////////////////////////////////////////
+	/// \fn DependencyTraceEvent()
+	/// \brief Constructor
+	//////////////////////////////////////////////////
+	DependencyTraceEvent();
+};
+
+} /* namespace SmartDG */
+
+#endif /* DEPENDENCYTRACEEVENT_H_ */
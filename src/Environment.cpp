@@ -24,7 +24,9 @@ Environment::Environment() {
 	SmartDG_GlobalFunction::EnvironmentGenerator(SmartDependencyObjects,
 			isMultiSmartDependencyObjects, SmartComponents, TransferFunctions,
 			InputPorts, OutputPorts, InputObjectInstances,
-			OutputObjectInstances, SmartConnectors, Wiki);
+			OutputObjectInstances, SmartConnectors, ConnectorFunctions, Wiki);
+	// Registers Connector policies bound by EnvironmentGenerator
+	DependencyConnector::Register(ConnectorFunctions);
 	// Calls GODInit()
 	GODInit();
 	// Calls SortAll()
@@ -33,7 +35,9 @@ Environment::Environment() {
 
 void Environment::GODInitTF(string g) {
 	TransferFunctions.emplace(g,
-			&SmartDG::TransferFunctionsNullNode::Instance001::TFT);
+			DependencyComponent(&SmartDG::TransferFunctionsNullNode::Instance001::TF,
+					&SmartDG::TransferFunctionsNullNode::Instance001::FT,
+					&SmartDG::TransferFunctionsNullNode::Instance001::List));
 }
 
 Environment::~Environment() {
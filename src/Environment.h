@@ -38,6 +38,7 @@ public:
 	map<string, vector<string>> InputObjectInstances; ///< A map from "Component name . Input port name" to a string vector of names of its Dependency object instances
 	map<string, vector<string>> OutputObjectInstances; ///< A map from "Component name . Output port name" to a string vector of names of its Dependency object instances
 	vector<string> SmartConnectors;	///< Connectors in the current Environment
+	SmartDG__cmap ConnectorFunctions; ///< Transfer functions for Connectors in the current Environment (Connectors not listed stay ideal connectors)
 	map<string, string> Wiki;///< Wiki strings for various elements in the current Environment
 	string godstr; ///< god string in use
 	//////////////////////////////////////////////////
@@ -46,6 +47,7 @@ public:
 	///
 	/// - Calls Environment::isMultiSmartDependencyObjectsInit()
 	/// - Calls SmartDG_GlobalFunction::EnvironmentGenerator to fetch the current Environment Elements
+	/// - Registers Environment::ConnectorFunctions with DependencyConnector::Register()
 	/// - Calls Environment::GODInit()
 	/// - Calls Environment::SortAll()
 	///
@@ -178,8 +180,7 @@ public:
 	void Display(SmartDG__map I) {
 		for (SmartDG__map::const_iterator it = I.begin(); it != I.end(); ++it) {
 			vector<string> Return;
-			vector<vector<SmartDG::DependencyPort> > DP;
-			it->second("List", Return, DP);
+			it->second.CallList(Return);
 			cout << it->first << ": ";
 			if (Return[0] == SmartDG_OK) {
 				for (unsigned int i = 1; i < Return.size(); i++)
@@ -0,0 +1,40 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	GUINode.cpp
+/// \brief	Source file for GUINode class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+
+GUINode::GUINode(const DependencyNode &n) {
+	Shape = NULL;
+	ShapeI = NULL;
+	ShapeO = NULL;
+	BarIn = NULL;
+	BarOut = NULL;
+	// Input and Output ports of DependencyNode
+	PortShape.resize(n.DP.size());
+	ObjectShape.resize(n.DP.size());
+	for (unsigned int io = 0; io < n.DP.size(); io++) {
+		PortShape[io].assign(n.DP[io].size(), NULL);
+		ObjectShape[io].resize(n.DP[io].size());
+		for (unsigned int p = 0; p < n.DP[io].size(); p++)
+			ObjectShape[io][p].assign(n.DP[io][p].DO.size(), NULL);
+	}
+}
+
+GUINode::~GUINode() {
+}
+
+} /* namespace SmartDG */
@@ -0,0 +1,59 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	GUINode.h
+/// \brief	Header file for GUINode class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GUINODE_H_
+#define GUINODE_H_
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+////////////////////////////////////////////////////////////////////////////////
+///	\class GUINode
+/// \brief GUINode class holds the FLTK graphic elements of a DependencyNode in one DependencyMonitor
+///
+/// DependencyNode objects are part of the DependencyGraph shared by all DependencyMonitor objects
+/// of a system. Each DependencyMonitor keeps a GUINode object for every DependencyNode it displays,
+/// with the Fl_Group objects of its DependencyPort and DependencyObject objects indexed as in
+/// DependencyNode::DP.
+////////////////////////////////////////////////////////////////////////////////
+class GUINode {
+public:
+	Fl_Group *Shape; ///< Points to Fl_Group object used to group all FLTK graphic elements associated with the DependencyNode
+	Fl_Group *ShapeI; ///< Points to Fl_Group object used to group all FLTK graphic elements associated with Input DependencyPort objects
+	Fl_Group *ShapeO; ///< Points to Fl_Group object used to group all FLTK graphic elements associated with Output DependencyPort objects
+	Fl_Menu_Bar *BarIn; ///< Points to Fl_Menu_Bar object used for Input DependencyPort objects
+	Fl_Menu_Bar *BarOut; ///< Points to Fl_Menu_Bar object used for Output DependencyPort objects
+	vector<vector<Fl_Group*> > PortShape; ///< Fl_Group object of every DependencyPort, [0/1][DependencyPort Index]
+	vector<vector<vector<Fl_Group*> > > ObjectShape; ///< Fl_Group object of every DependencyObject, [0/1][DependencyPort Index][DependencyObject Index]
+	//////////////////////////////////////////////////
+	/// \fn GUINode(const DependencyNode &n)
+	/// \brief Constructor
+	/// \param [in] n is the DependencyNode displayed
+	///
+	/// - Sizes GUINode::PortShape and GUINode::ObjectShape to DependencyNode::DP of n\n
+	/// - Sets all FLTK graphic object pointers to NULL
+	///
+	//////////////////////////////////////////////////
+	GUINode(const DependencyNode &n);
+	//////////////////////////////////////////////////
+	/// \fn ~GUINode()
+	/// \brief Default Destructor (FLTK graphic objects are owned by their Fl_Group parents)
+	//////////////////////////////////////////////////
+	virtual ~GUINode();
+};
+
+} /* namespace SmartDG */
+
+#endif /* GUINODE_H_ */
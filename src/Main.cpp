@@ -85,11 +85,88 @@ int Run(string mode, string displaymode) {
 	SmartDG::SmartDGGenerator DGG(SystemProjectName, DD, GUI, CIM, mode);
 	DGG.Display();
 	DGG.Show(displaymode);
-	std::thread LiteSyncThread(SmartDG_GlobalFunction::Makedgdatajson,
-			SmartDG_LiteFolderLocation);
 	return (Fl::run());
 }
 } /* namespace SystemProject_SystemAlpha */
+namespace Benchmark_DependencyDataBuffer {
+// Milliseconds elapsed since s
+double ms(chrono::steady_clock::time_point s) {
+	return chrono::duration<double, milli>(chrono::steady_clock::now() - s).count();
+}
+int Run(unsigned int numinstances) {
+	cout << "Smart Dependency Graph : Benchmark : " << numinstances
+			<< " udi values (SmartDG_PACKED_VALUES " << SmartDG_PACKED_VALUES
+			<< ")" << endl;
+	// Synthetic graph: numinstances / 2 ideal connectors, Source udi set in every third connector
+	unsigned int numdeps = numinstances / 2;
+	map<string, DependencyDataPackage> udi;	// udi storage as string keyed map (one entry per udi)
+	DependencyDataBuffer V;	// udi storage as DependencyDataBuffer (value ids 2 * id, 2 * id + 1)
+	vector<unsigned int> ids;
+	// Keys are built outside the timed loops, so the map timings measure lookups only
+	vector<string> outkeys(numdeps), inkeys(numdeps);
+	DependencyDataPackage d;
+	for (unsigned int i = 0; i < numdeps; i++) {
+		outkeys[i] = "N" + to_string(i) + ".Out.P.alpha";
+		inkeys[i] = "N" + to_string(i) + ".In.P.alpha";
+		d.b = (i % 3 == 0);
+		udi[outkeys[i]] = d;
+		udi[inkeys[i]] = DependencyDataPackage();
+		V.Add(d);
+		ids.push_back(V.Add(DependencyDataPackage()));
+	}
+	// Ideal connector propagation (TF of all connectors)
+	// Values are set one at a time, so the gain over the map comes from indexing and not from SmartDG_PACKED_VALUES
+	chrono::steady_clock::time_point s = chrono::steady_clock::now();
+	for (unsigned int i = 0; i < numdeps; i++)
+		udi[inkeys[i]].Set(udi[outkeys[i]].Get());
+	double tmap = ms(s);
+	s = chrono::steady_clock::now();
+	for (unsigned int i = 0; i < numdeps; i++)
+		V.Set(2 * i + 1, V.Get(2 * i));
+	double tbuf = ms(s);
+	cout << "Propagation  map " << tmap << " ms | buffer " << tbuf << " ms"
+			<< endl;
+	// Bias (number of true values)
+	s = chrono::steady_clock::now();
+	unsigned int cmap = 0;
+	for (map<string, DependencyDataPackage>::const_iterator it = udi.begin();
+			it != udi.end(); ++it)
+		if (it->second.b)
+			cmap++;
+	tmap = ms(s);
+	s = chrono::steady_clock::now();
+	unsigned int cbuf = V.Count();
+	tbuf = ms(s);
+	cout << "Count        map " << tmap << " ms | buffer " << tbuf << " ms ("
+			<< cmap << "/" << cbuf << ")" << endl;
+	// Sync diffing against a snapshot with one changed value in 64
+	map<string, DependencyDataPackage> udi2 = udi;
+	DependencyDataBuffer V2 = V;
+	for (unsigned int i = 0; i < numdeps; i += 32) {
+		udi2[inkeys[i]].Set(!udi2[inkeys[i]].Get());
+		V2.Set(2 * i + 1, !V2.Get(2 * i + 1).b);
+	}
+	s = chrono::steady_clock::now();
+	unsigned int dmap = 0;
+	for (map<string, DependencyDataPackage>::const_iterator it = udi.begin(),
+			it2 = udi2.begin(); it != udi.end(); ++it, ++it2)
+		if (it->second.b != it2->second.b)
+			dmap++;
+	tmap = ms(s);
+	s = chrono::steady_clock::now();
+	unsigned int dbuf = V.Diff(V2);
+	tbuf = ms(s);
+	cout << "Diff         map " << tmap << " ms | buffer " << tbuf << " ms ("
+			<< dmap << "/" << dbuf << ")" << endl;
+	// Storage of data items (map nodes and keys not included for map)
+	cout << "Storage      map >" << udi.size() * sizeof(DependencyDataPackage)
+			<< " bytes | buffer "
+			<< V.b.size() * sizeof(V.b[0])
+					+ V.changed.size() * sizeof(V.changed[0]) << " bytes"
+			<< endl;
+	return ((cmap == cbuf) && (dmap == dbuf)) ? 0 : 1;
+}
+} /* namespace Benchmark_DependencyDataBuffer */
 } /* namespace SmartDG */
 
 int main() {
@@ -97,6 +174,7 @@ int main() {
 	bool run_test_objectmode_systemproject = false;
 	bool run_test_componentmode_systemproject = false;
 	bool run_test_dualmode_systemproject = false;
+	bool run_benchmark_dependencydatabuffer = false;
 
 	//string displaymode = SmartDG_FLTK_DISPLAYMODE;
 	//string displaymode = SmartDG_LITE_DISPLAYMODE;
@@ -122,5 +200,7 @@ int main() {
 
 		return (SmartDG::SystemProject_SystemAlpha::Run(mode, displaymode));
 	}
+	if (run_benchmark_dependencydatabuffer)
+		return (SmartDG::Benchmark_DependencyDataBuffer::Run(1000000));
 	return 1;
 }
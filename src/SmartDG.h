@@ -28,6 +28,16 @@
 #include <cmath>
 #include <map>
 #include <unordered_map>
+#include <bitset>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <type_traits>
+#include <functional>
+#include <deque>
+#include <mutex>
+#include <memory>
+#include <atomic>
 
 using namespace std;
 
@@ -180,17 +190,41 @@ namespace SmartDG {
 #endif
 //// DO NOT CHANGE 														END
 
-// Verbose
-#define SmartDG_Verbose false
-#define SmartDG_MonitorWindowMenuBarVerbose 	SmartDG_Verbose & false
-#define SmartDG_NodeMenuBarVerbose 				SmartDG_Verbose & false
-#define SmartDG_SolverVerbose 					SmartDG_Verbose & false
-#define SmartDG_SyncVerbose 					SmartDG_Verbose & false
-#define SmartDG_SyncLiteVerbose					SmartDG_Verbose & false
-#define SmartDG_TransferFunctionsVerbose 		SmartDG_Verbose & false
+// Trace
+#define SmartDG_TRACE_OFF 0 // Nothing is traced
+#define SmartDG_TRACE_SOLVER 1 // Solver begin and end events
+#define SmartDG_TRACE_CALLS 2 // Connector and DependencyNode call events
+#define SmartDG_TRACE_VERBOSE 3 // Verbose messages to cout (menus, Sync, transfer functions)
+#define SmartDG_TRACE_LEVEL SmartDG_TRACE_CALLS // Highest level compiled in (SmartDG_TRACE_OFF compiles all trace out)
+#define SmartDG_TRACE_RING 4096 // Number of events kept by DependencyTrace
+// Events of DependencyTraceEvent::kind
+#define SmartDG_TRACE_EVENT_SOLVE 0
+#define SmartDG_TRACE_EVENT_CONNECTOR 1
+#define SmartDG_TRACE_EVENT_NODE 2
+#define SmartDG_TRACE_EVENT_SOLVED 3
+// true if level l is compiled in and enabled at run time (DependencyTrace::level)
+#define SmartDG_TRACE_ON(l) (((l) <= SmartDG_TRACE_LEVEL) && ((l) <= SmartDG::DependencyTrace::level))
+// Records a DependencyTraceEvent of level l
+#define SmartDG_TRACE(l, kind, direction, id, value, flag) \
+	do { \
+		if (SmartDG_TRACE_ON(l)) \
+			SmartDG::DependencyTrace::Record(l, kind, direction, id, value, flag); \
+	} while (0)
+
+// Solve statistics
+#define SmartDG_SOLVE_NODE_TIMING false // true times every Component TF/FT call (DependencySolveStats::nodeTime, two clock reads per call)
+
+// Verbose (SmartDG_TRACE_VERBOSE level of the trace)
+#define SmartDG_Verbose SmartDG_TRACE_ON(SmartDG_TRACE_VERBOSE)
+#define SmartDG_MonitorWindowMenuBarVerbose 	SmartDG_Verbose && true
+#define SmartDG_NodeMenuBarVerbose 				SmartDG_Verbose && true
+#define SmartDG_SolverVerbose 					SmartDG_Verbose && true
+#define SmartDG_SyncVerbose 					SmartDG_Verbose && true
+#define SmartDG_SyncLiteVerbose					SmartDG_Verbose && true
+#define SmartDG_TransferFunctionsVerbose 		SmartDG_Verbose && true
 #define SmartDG_TFV SmartDG_TransferFunctionsVerbose
-#define SmartDG_RefreshEditMenuVerbose 			SmartDG_Verbose & false
-#define SmartDG_RefreshNodeEditMenuVerbose 		SmartDG_Verbose & false
+#define SmartDG_RefreshEditMenuVerbose 			SmartDG_Verbose && true
+#define SmartDG_RefreshNodeEditMenuVerbose 		SmartDG_Verbose && true
 #define SmartDG_WIDTH_OF_LONGEST_ENTRY 50
 #define SmartDG_COLUMN_WIDTH SmartDG_WIDTH_OF_LONGEST_ENTRY + 4
 
@@ -200,24 +234,40 @@ namespace SmartDG {
 
 // Solver
 #define SmartDG_CIRCULAR_DEPENDENCY_BREAKOUT_COUNT 1000
+#define SmartDG_TOPOLOGICAL_SOLVER true
+
+// Values
+#define SmartDG_PACKED_VALUES true // DependencyDataBuffer stores boolean data items 64 per word
+// Data types of DependencyDataPackage
+#define SmartDG_DATATYPE_BOOL 0
+#define SmartDG_DATATYPE_INT 1
+#define SmartDG_DATATYPE_REAL 2
+#define SmartDG_DATATYPE_ENUM 3
+#define SmartDG_DATATYPE_STRUCT 4
 
 // Sync
 #define SmartDG_SYNC true
 #define SmartDG_View2ViewFlag_DEFAULT_VALUE SmartDG_SYNC && true
 #define SmartDG_SolverSync_DEFAULT_VALUE 	SmartDG_SYNC && true
+#define SmartDG_SYNC_QUEUE_LIMIT 65536
+#define SmartDG_SYNC_UNSUBSCRIBED (~0UL)
+#define SmartDG_URL_SYMBOL_CHUNK 4096
+#define SmartDG_URL_SYMBOL_CHUNKS 4096
+#define SmartDG_LITE_SERVER_PORT 3000
+#define SmartDG_LITE_REQUEST_LIMIT 65536
+#define SmartDG_LITE_JS_PATH "/usr/local/include/SmartDG/js"
 
 // System Commands
-#define SmartDG_XMESSAGE_SYNC_COMMAND "xmessage \"Synchronizing... Please Wait.\" -timeout 1 &"
 #define SmartDG_PRINT_SCREEN_COMMAND "gnome-screenshot -w &"
-#define SmartDG_Lite_Server_Launch_COMMAND "browser-sync start --server --directory --files '**/*'"
-#define SmartDG_Lite_Launch_COMMAND_Chrome "google-chrome SmartDGlite/DGlite.html &"
-#define SmartDG_Lite_Launch_COMMAND_Firefox "firefox SmartDGlite/DGlite.html &"
+#define SmartDG_STRINGIFY_(x) #x
+#define SmartDG_STRINGIFY(x) SmartDG_STRINGIFY_(x)
+#define SmartDG_Lite_URL "http://localhost:" SmartDG_STRINGIFY(SmartDG_LITE_SERVER_PORT) "/" SmartDG_BaseLite ".html"
+#define SmartDG_Lite_Launch_COMMAND_Chrome "google-chrome " SmartDG_Lite_URL " &"
+#define SmartDG_Lite_Launch_COMMAND_Firefox "firefox " SmartDG_Lite_URL " &"
 
 // Delays In milliseconds
-#define SmartDG_SLEEP_BETWEEN_SYNCOUT_SYNCIN 100
-#define SmartDG_SLEEP_BETWEEN_SYNLITE 2000
+#define SmartDG_SLEEP_BETWEEN_SYNLITE 500
 #define SmartDG_SLEEP_BEFORE_PRINT_SCREEN_COMMAND 1000
-#define SmartDG_SLEEP_AFTER_SERVER_LAUNCH_COMMAND 1000
 
 //GOD
 #define SmartDG_DEFAULT_NUMGOD 12
@@ -225,15 +275,23 @@ namespace SmartDG {
 } /* namespace SmartDG */
 
 //=============================== Specific CPP
+#include "DependencyJSON.h"
+#include "DependencyTraceEvent.h"
+#include "DependencyTrace.h"
+#include "DependencySolveStats.h"
 #include "DependencyDescriptor.h"
 #include "GUIPoint.h"
 #include "URL.h"
 #include "DependencyDataPackage.h"
+#include "DependencyDataChanges.h"
+#include "DependencyDataBuffer.h"
+#include "DependencyDataStore.h"
+#include "DependencyLiteSnapshot.h"
 namespace SmartDG_GlobalData {
-extern map<string, map<string, SmartDG::DependencyDataPackage> > GlobalPackage;
+extern SmartDG::DependencyDataStore GlobalPackage;
 }
 namespace SmartDG_GlobalData {
-extern map<string, string> GlobalPackageLite;
+extern SmartDG::DependencyLiteSnapshot GlobalPackageLite;
 }
 namespace SmartDG_GlobalData {
 extern map<string, SmartDG::DependencyDataPackage> GlobalDebug;
@@ -242,14 +300,22 @@ namespace SmartDG_GlobalData {
 extern bool View2ViewFlag;
 }
 namespace SmartDG_GlobalData {
-extern int togglelive;
+extern atomic<int> togglelive;
 }
 #include "GUILine.h"
 #include "GUIText.h"
 #include "GUIConnection.h"
 #include "DependencyObject.h"
 #include "DependencyPort.h"
+#include "DependencyComponent.h"
 #include "DependencyNode.h"
+#include "GUINode.h"
+#include "Dependency.h"
+#include "TransferFunctionHelper.h"
+#include "TransferFunctionsNullNode.h"
+#include "TransferFunctionsConnector.h"
+#include "TransferFunctionsIdealConnector.h"
+#include "DependencyConnector.h"
 namespace SmartDG_GlobalFunction {
 extern void EnvironmentGenerator(vector<string> &SmartDependencyObjects,
 		map<string, bool> &isMultiSmartDependencyObjects,
@@ -258,17 +324,21 @@ extern void EnvironmentGenerator(vector<string> &SmartDependencyObjects,
 		map<string, vector<string>> &OutputPorts,
 		map<string, vector<string>> &InputObjectInstances,
 		map<string, vector<string>> &OutputObjectInstances,
-		vector<string> &SmartConnectors, map<string, string> &Wiki);
-extern void Makedgdatajson(string Location = SmartDG_LiteFolderLocation);
+		vector<string> &SmartConnectors, SmartDG__cmap &ConnectorFunctions,
+		map<string, string> &Wiki);
 }
-#include "Dependency.h"
 #include "Environment.h"
-#include "TransferFunctionHelper.h"
-#include "TransferFunctionsNullNode.h"
-#include "TransferFunctionsIdealConnector.h"
 #include "DependencyObjectInstance.h"
 #include "DependencyObjectInstances.h"
+#include "DependencyContext.h"
+#include "DependencyGraphObserver.h"
 #include "DependencyGraph.h"
+#include "DependencySyncEvent.h"
+#include "DependencySyncBus.h"
+#include "DependencyLiteServer.h"
+#include "DependencyLiteWriter.h"
+#include "WorkStealingPool.h"
+#include "DependencyMenuHandle.h"
 #include "DependencyMonitor.h"
 #include "SmartDGGenerator.h"
 
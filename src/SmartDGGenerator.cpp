@@ -108,7 +108,10 @@ void SmartDGGenerator::SystemDevelopmentMode(string &SystemProjectName,
 					SystemProjectName + " Monitor", SystemProjectName,
 					it->second, SmartDG_COMPONENT_MODE);
 	}
-	DependencyGraph DGtmp;
+	// One DependencyGraph is built and shared by all monitors of the system
+	shared_ptr<DependencyGraph> G = make_shared<DependencyGraph>(
+			SystemProjectName);
+	DependencyGraph &DGtmp = *G;
 	for (map<string, string>::const_iterator it = SystemNodes.begin();
 			it != SystemNodes.end(); ++it) {
 		DependencyNode tmpnode(it->second);
@@ -144,25 +147,30 @@ void SmartDGGenerator::SystemDevelopmentMode(string &SystemProjectName,
 		string o = DD[i].DependencyObjectName;
 		string n2 = DD[i].ToDependencyNodeName;
 		string p2 = DD[i].ToDependencyPortName;
-		URL fromurl = DGtmp.ulm[n1]["Out"][p1][o];
-		URL tourl = DGtmp.ulm[n2]["In"][p2][o];
-		Dependency tmpdep(DD[i].DependencyName, fromurl, tourl);
-		DGtmp.AddDependency(tmpdep);
+		DGtmp.AddDependency(DD[i].DependencyName, n1, p1, o, n2, p2, o);
 	}
+	DGtmp.Generate_SCC();
 	for (map<string, string>::const_iterator it = SystemViews.begin();
 			it != SystemViews.end(); ++it) {
 		for (unsigned int i = 0; i < DGtmp.DN.size(); i++) {
 			DGtmp.DN[i].TFT = XE.TransferFunctions[CIM[DGtmp.DN[i].Name]];
 		}
 	}
+	// TF handles are bound once per DependencyNode
+	for (unsigned int i = 0; i < DGtmp.DN.size(); i++)
+		if (!DGtmp.DN[i].Bind())
+			setexit = 0;
+	if (setexit == 0)
+		exit(0);
+	// All monitors share G (each keeps its own GUI widgets and menu context)
 	if ((Mode == SmartDG_OBJECT_MODE) || (Mode == SmartDG_DUAL_MODE))
 		for (map<string, string>::const_iterator it = SystemViews.begin();
 				it != SystemViews.end(); ++it)
-			DependencyMonitors[it->second]->DG = DGtmp;
+			DependencyMonitors[it->second]->DG = G;
 	if ((Mode == SmartDG_COMPONENT_MODE) || (Mode == SmartDG_DUAL_MODE))
 		for (map<string, string>::const_iterator it = SystemNodes.begin();
 				it != SystemNodes.end(); ++it)
-			ComponentMonitors[it->second]->DG = DGtmp;
+			ComponentMonitors[it->second]->DG = G;
 }
 
 void SmartDGGenerator::ComponentDevelopmentMode() {
@@ -236,7 +244,9 @@ void SmartDGGenerator::ComponentDevelopmentMode() {
 	ComponentDeveloper = new DependencyMonitor("Component Development",
 			"Component Development", ComponentName,
 			SmartDG_COMPONENT_DEVELOPER_MODE);
-	DependencyGraph DGtmp;
+	shared_ptr<DependencyGraph> G = make_shared<DependencyGraph>(
+			"Component Development");
+	DependencyGraph &DGtmp = *G;
 	for (map<string, string>::const_iterator it = SystemNodes.begin();
 			it != SystemNodes.end(); ++it) {
 		DependencyNode tmpnode(it->second);
@@ -273,18 +283,22 @@ void SmartDGGenerator::ComponentDevelopmentMode() {
 		string o = DD[i].DependencyObjectName;
 		string n2 = DD[i].ToDependencyNodeName;
 		string p2 = DD[i].ToDependencyPortName;
-		URL fromurl = DGtmp.ulm[n1]["Out"][p1][o];
-		URL tourl = DGtmp.ulm[n2]["In"][p2][o];
-		Dependency tmpdep(DD[i].DependencyName, fromurl, tourl);
-		DGtmp.AddDependency(tmpdep);
+		DGtmp.AddDependency(DD[i].DependencyName, n1, p1, o, n2, p2, o);
 	}
+	DGtmp.Generate_SCC();
 	for (map<string, string>::const_iterator it = SystemViews.begin();
 			it != SystemViews.end(); ++it) {
 		for (unsigned int i = 0; i < DGtmp.DN.size(); i++) {
 			DGtmp.DN[i].TFT = XE.TransferFunctions[DGtmp.DN[i].Name];
 		}
 	}
-	ComponentDeveloper->DG = DGtmp;
+	// TF handles are bound once per DependencyNode
+	for (unsigned int i = 0; i < DGtmp.DN.size(); i++)
+		if (!DGtmp.DN[i].Bind())
+			setexit = 0;
+	if (setexit == 0)
+		exit(0);
+	ComponentDeveloper->DG = G;
 }
 
 template<typename T>
@@ -376,7 +390,7 @@ void SmartDGGenerator::Display(bool showwiki) {
 		for (map<string, string>::const_iterator it = SystemViews.begin();
 				it != SystemViews.end(); ++it) {
 			cout << "----------------------------View " << it->second << endl;
-			DependencyMonitors[it->second]->DG.DisplayDependencyMini(
+			DependencyMonitors[it->second]->DG->DisplayDependencyMini(
 					it->second);
 		}
 	}
@@ -407,6 +421,62 @@ void SmartDGGenerator::Display(bool showwiki) {
 			DD[i].Display();
 	}
 }
+bool SmartDGGenerator::SolveAll(int direction, unsigned int threads) {
+	vector<string> views;
+	vector<DependencyMonitor*> monitors;
+	for (map<string, DependencyMonitor*>::const_iterator it =
+			DependencyMonitors.begin(); it != DependencyMonitors.end(); ++it) {
+		views.push_back(it->first);
+		monitors.push_back(it->second);
+	}
+	// Value ids of every view (Source and Target udi of its Connectors)
+	vector<vector<unsigned int> > vids(monitors.size());
+	for (unsigned int m = 0; m < monitors.size(); m++) {
+		vector<Dependency> &V = monitors[m]->DG->View[views[m]];
+		for (unsigned int i = 0; i < V.size(); i++) {
+			vids[m].push_back(V[i].FromValue());
+			vids[m].push_back(V[i].ToValue());
+		}
+	}
+	// Solves every view on a WorkStealingPool, each on a private full copy of the values
+	vector<char> converged(monitors.size(), false);
+	vector<shared_ptr<DependencyDataBuffer> > snapshots(monitors.size());
+	vector<function<void()> > tasks;
+	for (unsigned int m = 0; m < monitors.size(); m++)
+		tasks.push_back([&, m]() {
+			snapshots[m] = make_shared<DependencyDataBuffer>(
+					*monitors[m]->DG->Values);
+			converged[m] = monitors[m]->Solve(direction, *snapshots[m]);
+		});
+	WorkStealingPool pool(threads);
+	pool.Run(tasks);
+	// Buffers of all monitors (a single one when the DependencyGraph is shared)
+	vector<DependencyMonitor*> all = monitors;
+	for (map<string, DependencyMonitor*>::const_iterator it =
+			ComponentMonitors.begin(); it != ComponentMonitors.end(); ++it)
+		all.push_back(it->second);
+	vector<DependencyDataBuffer*> buffers;
+	for (unsigned int o = 0; o < all.size(); o++)
+		if (find(buffers.begin(), buffers.end(), all[o]->DG->Values.get())
+				== buffers.end())
+			buffers.push_back(all[o]->DG->Values.get());
+	// Merges the udi of every view into GlobalPackage and all buffers
+	bool ok = true;
+	for (unsigned int m = 0; m < monitors.size(); m++) {
+		ok = ok && converged[m];
+		DependencyGraph &G = *monitors[m]->DG;
+		for (unsigned int k = 0; k < vids[m].size(); k++) {
+			DependencyObjectInstance &oi = G.DOI.I[G.DOI.vi[vids[m][k]]];
+			DependencyDataPackage d = snapshots[m]->Get(vids[m][k]);
+			SmartDG_GlobalData::GlobalPackage.Set(oi.pou.str(), oi.tou.str(),
+					d);
+			for (unsigned int b = 0; b < buffers.size(); b++)
+				buffers[b]->Set(vids[m][k], d);
+		}
+	}
+	return ok;
+}
+
 SmartDGGenerator::~SmartDGGenerator() {
 }
 
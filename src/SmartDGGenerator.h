@@ -48,6 +48,10 @@ class SmartDGGenerator {
 	///	\param [in] DD is a vector of DependencyDescriptor objects
 	///	\param [in] GUI is a map from Component/DependencyNode name to its coordinate in the component architecture diagram
 	///	\param [in] CIM is Component Instance Map is component instance name string to its base component name string
+	///
+	/// All DependencyMonitors and ComponentMonitors share one DependencyGraph::Values
+	/// (DependencyGraph::ShareValues()), so that memory for values does not grow with the number
+	/// of views and no data Sync is needed between them.
 	/// \see ComponentDevelopmentMode()
 	//////////////////////////////////////////////////
 	void SystemDevelopmentMode(string &SystemProjectName,
@@ -116,6 +120,23 @@ public:
 	//////////////////////////////////////////////////
 	void Display(bool showwiki = false);
 	//////////////////////////////////////////////////
+	/// \fn bool SolveAll(int direction = 1, unsigned int threads = 0)
+	/// \brief Solves all DependencyObject specific views headless and in parallel
+	/// \param [in] direction is 1 for transfer functions (TF) and -1 for inverse transfer functions (FT)
+	/// \param [in] threads is the number of worker threads (0 : number of hardware threads)
+	/// \return [bool] true if all views converged
+	///
+	/// - Calls DependencyMonitor::Solve(int direction, DependencyDataBuffer &values) of all
+	/// DependencyMonitors on a WorkStealingPool, each on a private copy of DependencyGraph::Values
+	/// (views of different DependencyObject objects touch disjoint udi, transfer functions read
+	/// the current values of all DependencyObjects)\n
+	/// - Merges the udi of every view (value ids of its Connectors, no scan of DOI) into SmartDG_GlobalData::GlobalPackage and into
+	/// DependencyGraph::Values of all DependencyMonitors and ComponentMonitors (a single
+	/// DependencyGraph shared by all of them when built by SystemDevelopmentMode())
+	///
+	//////////////////////////////////////////////////
+	bool SolveAll(int direction = 1, unsigned int threads = 0);
+	//////////////////////////////////////////////////
 	/// \fn ~SmartDGGenerator()
 	/// \brief Default Destructor
 	//////////////////////////////////////////////////
@@ -20,11 +20,11 @@
 #include "TestTransferFunctionsDG.h"
 
 namespace SmartDG_GlobalData {
-map<string, map<string, SmartDG::DependencyDataPackage> > GlobalPackage;
-map<string, string> GlobalPackageLite;
+SmartDG::DependencyDataStore GlobalPackage;
+SmartDG::DependencyLiteSnapshot GlobalPackageLite;
 map<string, SmartDG::DependencyDataPackage> GlobalDebug;
 bool View2ViewFlag = SmartDG_View2ViewFlag_DEFAULT_VALUE;
-int togglelive = 0;
+atomic<int> togglelive(0);
 }
 
 namespace SmartDG_GlobalFunction {
@@ -35,7 +35,8 @@ void EnvironmentGenerator(vector<string> &SmartDependencyObjects,
 		map<string, vector<string>> &OutputPorts,
 		map<string, vector<string>> &InputObjectInstances,
 		map<string, vector<string>> &OutputObjectInstances,
-		vector<string> &SmartConnectors, map<string, string> &Wiki) {
+		vector<string> &SmartConnectors,
+		SmartDG__cmap &ConnectorFunctions, map<string, string> &Wiki) {
 	cout << "Possibilities are Endless in Life!!" << endl;
 	SmartDependencyObjects.push_back("alpha");
 	Wiki["alpha"] = "Demo object alpha";
@@ -57,7 +58,11 @@ void EnvironmentGenerator(vector<string> &SmartDependencyObjects,
 	OutputPorts["DGTest"].push_back("DGTestOut");
 	OutputObjectInstances["DGTest.DGTestOut"].push_back("gamma");
 	OutputObjectInstances["DGTest.DGTestOut"].push_back("hooah");
-	TransferFunctions.emplace("DGTest", &SmartDG::TransferFunctionsDGTest::TFT);
+	// Typed Smart Component (DGTestA to DGTestD use the string dispatched SFPT)
+	TransferFunctions.emplace("DGTest",
+			SmartDG::DependencyComponent(&SmartDG::TransferFunctionsDGTest::TF,
+					&SmartDG::TransferFunctionsDGTest::FT,
+					&SmartDG::TransferFunctionsDGTest::List));
 
 	SmartComponents.push_back("DGTestA");
 	Wiki["DGTestA"] = "Demo Component A";
@@ -99,58 +104,11 @@ void EnvironmentGenerator(vector<string> &SmartDependencyObjects,
 	// Smart Connectors
 	SmartConnectors.push_back("CS05");
 	SmartConnectors.push_back("AF42");
+	Wiki["AF42"] = "Demo Connector (inverting)";
+	ConnectorFunctions["AF42"] = SmartDG::DependencyConnector::Bind<
+			SmartDG::TransferFunctionsConnector::Inverting>();
 	SmartConnectors.push_back("Unnamed");
 }
-
-void Makedgdatajson(string Location) {
-	string DGliteDir1 = Location + "/" + string(SmartDG_LiteFoldername);
-	string DGliteDir2 = "~/." + string(SmartDG_LiteFoldername);
-	std::system(string("mkdir -p " + DGliteDir1).c_str());
-	std::system(string("mkdir -p " + DGliteDir2).c_str());
-
-	ofstream LaunchServer;
-	LaunchServer.open(DGliteDir1 + "/LaunchServer.sh", ios::trunc);
-	LaunchServer << SmartDG_Lite_Server_Launch_COMMAND << endl;
-	LaunchServer.close();
-	std::system(
-			string(
-					"cp " + string(DGliteDir1 + "/LaunchServer.sh ")
-							+ DGliteDir2).c_str());
-
-	string DGliteJSONFile = string(
-			DGliteDir1 + "/" + SmartDG_BaseLite + ".json");
-	while (true) {
-		if (SmartDG_SyncLiteVerbose)
-			cout << "Makedgdatajson " << SmartDG_GlobalData::togglelive << endl;
-		ofstream jsonfile;
-		jsonfile.open(DGliteJSONFile);
-		if (!jsonfile)
-			if (SmartDG_SyncLiteVerbose)
-				cout << DGliteJSONFile << "  " << "Error ! Open\n"
-						<< strerror(errno) << endl;
-		jsonfile << "var dgdata = [" << endl;
-		jsonfile << "{\"id\":\"" << "#BLINKY" << "\",\"val\":\""
-				<< to_string(SmartDG_GlobalData::togglelive) << "\"}," << endl;
-		SmartDG_GlobalData::togglelive++;
-		if (SmartDG_GlobalData::togglelive == 11)
-			SmartDG_GlobalData::togglelive = 0;
-		for (map<string, string>::const_iterator it =
-				SmartDG_GlobalData::GlobalPackageLite.begin();
-				it != SmartDG_GlobalData::GlobalPackageLite.end(); ++it) {
-			jsonfile << "{\"id\":\"" << it->first << "\",\"val\":\""
-					<< it->second << "\"}," << endl;
-		}
-		jsonfile << "]" << endl;
-		jsonfile.close();
-		if (!jsonfile)
-			if (SmartDG_SyncLiteVerbose)
-				cout << DGliteJSONFile << "  " << "Error ! Close\n"
-						<< strerror(errno) << endl;
-		std::system(string("cp " + DGliteJSONFile + " " + DGliteDir2).c_str());
-		std::this_thread::sleep_for(
-				std::chrono::milliseconds(SmartDG_SLEEP_BETWEEN_SYNLITE));
-	}
-}
 }
 
 #endif /* TESTENVIRONMENTSMARTDG_H_ */
@@ -26,16 +26,22 @@ inline string Name() {
 	return "TestTF";
 }
 
-inline void TF(vector<string> &Return) {
+inline void TF(vector<vector<SmartDG::DependencyPort> >& DP) {
 	if (SmartDG_TFV)
 		cout << "TF" << endl;
-	Return.push_back(SmartDG_OK);
 }
 
-inline void FT(vector<string> &Return) {
+inline void FT(vector<vector<SmartDG::DependencyPort> >& DP) {
 	if (SmartDG_TFV)
 		cout << "FT" << endl;
+}
+
+inline void List(vector<string> &Return) {
 	Return.push_back(SmartDG_OK);
+	Return.push_back("List");
+	Return.push_back("Name");
+	Return.push_back("TF");
+	Return.push_back("FT");
 }
 
 inline void TFT(string Fun, vector<string> &Return,
@@ -44,11 +50,7 @@ inline void TFT(string Fun, vector<string> &Return,
 		cout << "TestTransferFunction" << "SmartComponent " << Name() << " "
 				<< Fun << endl;
 	if (Fun == "List") {
-		Return.push_back(SmartDG_OK);
-		Return.push_back("List");
-		Return.push_back("Name");
-		Return.push_back("TF");
-		Return.push_back("FT");
+		List(Return);
 		return;
 	}
 	if (Fun == "Name") {
@@ -57,11 +59,13 @@ inline void TFT(string Fun, vector<string> &Return,
 		return;
 	}
 	if (Fun == "TF") {
-		TF(Return);
+		TF(DP);
+		Return.push_back(SmartDG_OK);
 		return;
 	}
 	if (Fun == "FT") {
-		FT(Return);
+		FT(DP);
+		Return.push_back(SmartDG_OK);
 		return;
 	}
 
@@ -21,6 +21,16 @@ TransferFunctionHelper::TransferFunctionHelper() {
 }
 
 bool TransferFunctionHelper::Get(vector< vector<DependencyPort> >& DP, string IO, string Port, string Obj)	{
+	return GetData(DP, IO, Port, Obj).b;
+}
+
+bool TransferFunctionHelper::Set(vector< vector<DependencyPort> >& DP, string IO, string Port, string Obj, bool val)	{
+	DependencyDataPackage ddp;
+	ddp.b = val;
+	return SetData(DP, IO, Port, Obj, ddp);
+}
+
+DependencyDataPackage TransferFunctionHelper::GetData(vector< vector<DependencyPort> >& DP, string IO, string Port, string Obj)	{
 	unsigned int i = 0;
 	if (IO == "In") i = 0;
 	if (IO == "Out") i = 1;
@@ -28,14 +38,14 @@ bool TransferFunctionHelper::Get(vector< vector<DependencyPort> >& DP, string IO
 		if ( DP[i][j].Name == Port)	{
 			for(unsigned int k = 0; k< DP[i][j].DO.size(); k++)	{
 				if (DP[i][j].DO[k].Name == Obj)
-					return DP[i][j].DO[k].Get().b;
+					return DP[i][j].DO[k].Get();
 			}
 		}
 	}
-	return false;
+	return DependencyDataPackage();
 }
 
-bool TransferFunctionHelper::Set(vector< vector<DependencyPort> >& DP, string IO, string Port, string Obj, bool val)	{
+bool TransferFunctionHelper::SetData(vector< vector<DependencyPort> >& DP, string IO, string Port, string Obj, DependencyDataPackage val)	{
 	unsigned int i = 0;
 	if (IO == "In") i = 0;
 	if (IO == "Out") i = 1;
@@ -43,9 +53,7 @@ bool TransferFunctionHelper::Set(vector< vector<DependencyPort> >& DP, string IO
 		if ( DP[i][j].Name == Port)	{
 			for(unsigned int k = 0; k< DP[i][j].DO.size(); k++)	{
 				if (DP[i][j].DO[k].Name == Obj)	{
-					DependencyDataPackage ddp;
-					ddp.b = val;
-					DP[i][j].DO[k].Set(ddp);
+					DP[i][j].DO[k].Set(val);
 					return true;
 				}
 			}
@@ -54,6 +62,46 @@ bool TransferFunctionHelper::Set(vector< vector<DependencyPort> >& DP, string IO
 	return false;
 }
 
+bool TransferFunctionHelper::Bind(vector< vector<DependencyPort> >& DP, string IO, string Port, string Obj, URL &handle)	{
+	unsigned int i = 2;
+	if (IO == "In") i = 0;
+	if (IO == "Out") i = 1;
+	if (i < DP.size())	{
+		for(unsigned int j = 0; j< DP[i].size(); j++)	{
+			if ( DP[i][j].Name == Port)	{
+				for(unsigned int k = 0; k< DP[i][j].DO.size(); k++)	{
+					if (DP[i][j].DO[k].Name == Obj)	{
+						// Indices of the DependencyObject in DP
+						handle = URL(0, i, j, k);
+						return true;
+					}
+				}
+			}
+		}
+	}
+	// Misspelled names fail here instead of in every Get/Set
+	cout << "ERROR[TF HANDLE NOT BOUND]: " << IO << "." << Port << "." << Obj << endl;
+	return false;
+}
+
+bool TransferFunctionHelper::Get(vector< vector<DependencyPort> >& DP, const URL &handle)	{
+	return GetData(DP, handle).b;
+}
+
+void TransferFunctionHelper::Set(vector< vector<DependencyPort> >& DP, const URL &handle, bool val)	{
+	DependencyDataPackage ddp;
+	ddp.b = val;
+	SetData(DP, handle, ddp);
+}
+
+DependencyDataPackage TransferFunctionHelper::GetData(vector< vector<DependencyPort> >& DP, const URL &handle)	{
+	return DP[handle.InOutIndex][handle.PortIndex].DO[handle.ObjectIndex].Get();
+}
+
+void TransferFunctionHelper::SetData(vector< vector<DependencyPort> >& DP, const URL &handle, DependencyDataPackage val)	{
+	DP[handle.InOutIndex][handle.PortIndex].DO[handle.ObjectIndex].Set(val);
+}
+
 TransferFunctionHelper::~TransferFunctionHelper() {
 }
 
@@ -22,12 +22,26 @@ namespace SmartDG {
 ////////////////////////////////////////////////////////////////////////////////
 ///	\class TransferFunctionHelper
 /// \brief TransferFunctionHelper contains helper functions for Transfer Functions
+///
+/// Get/Set with IO, Port and Obj strings search DP by name on every call.
+/// Bind resolves the names once to an index URL handle (InOutIndex, PortIndex and ObjectIndex
+/// of the object in DP, not DependencyObject::url), and Get/Set with the handle are direct accesses.
+/// Handles are bound per DependencyNode at graph build (DependencyNode::Bind() for the
+/// DependencyComponent::Bindings of a Smart Component) and passed to HTF/HFT, e.g.:\n
+/// bool v = H.Get(DP, Handles[0]);
 ////////////////////////////////////////////////////////////////////////////////
 class TransferFunctionHelper {
 public:
 	TransferFunctionHelper();
 	bool Get(vector< vector<DependencyPort> >& DP, string IO, string Port, string Obj);
 	bool Set(vector< vector<DependencyPort> >& DP, string IO, string Port, string Obj, bool val);
+	DependencyDataPackage GetData(vector< vector<DependencyPort> >& DP, string IO, string Port, string Obj);
+	bool SetData(vector< vector<DependencyPort> >& DP, string IO, string Port, string Obj, DependencyDataPackage val);
+	bool Bind(vector< vector<DependencyPort> >& DP, string IO, string Port, string Obj, URL &handle);
+	bool Get(vector< vector<DependencyPort> >& DP, const URL &handle);
+	void Set(vector< vector<DependencyPort> >& DP, const URL &handle, bool val);
+	DependencyDataPackage GetData(vector< vector<DependencyPort> >& DP, const URL &handle);
+	void SetData(vector< vector<DependencyPort> >& DP, const URL &handle, DependencyDataPackage val);
 	virtual ~TransferFunctionHelper();
 };
 
@@ -0,0 +1,86 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	TransferFunctionsConnector.h
+/// \brief	Header file for Transfer Function templates and policies for Connectors
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TRANSFERFUNCTIONSCONNECTOR_H_
+#define TRANSFERFUNCTIONSCONNECTOR_H_
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+namespace TransferFunctionsConnector {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Connector policies
+///
+/// A policy is a class with an inline static Apply(source, V, target) that returns the value
+/// a Connector writes to udi target of DependencyDataBuffer V. TF<Policy> and FT<Policy> are instantiated per
+/// policy, so the policy is compiled into the transfer function itself.
+/// Connector types are bound to a policy with DependencyConnector::Register().
+////////////////////////////////////////////////////////////////////////////////
+
+///> Copies the source value
+struct Ideal {
+	static DependencyDataPackage Apply(const DependencyDataPackage &source,
+			DependencyDataBuffer &V, unsigned int target) {
+		return source;
+	}
+};
+
+///> Copies the negated source value
+struct Inverting {
+	static DependencyDataPackage Apply(const DependencyDataPackage &source,
+			DependencyDataBuffer &V, unsigned int target) {
+		DependencyDataPackage d = source;
+		d.b = !source.b;
+		return d;
+	}
+};
+
+///> Once the target is true it stays true
+struct Latching {
+	static DependencyDataPackage Apply(const DependencyDataPackage &source,
+			DependencyDataBuffer &V, unsigned int target) {
+		DependencyDataPackage d = source;
+		d.b = source.b || V.Get(target).b;
+		return d;
+	}
+};
+
+template<class Policy>
+inline void TF(vector<vector<SmartDG::DependencyPort> >& DPIn,
+		vector<vector<SmartDG::DependencyPort> >& DPOut,
+		SmartDG::Dependency &d) {
+	if (SmartDG_TFV)
+		cout << "TF " << d.Name << endl;
+	SmartDG::DependencyDataBuffer &V =
+			*DPIn[d.From.InOutIndex][d.From.PortIndex].DO[d.From.ObjectIndex].Buffer();
+	V.Set(d.ToValue(), Policy::Apply(V.Get(d.FromValue()), V, d.ToValue()));
+}
+
+template<class Policy>
+inline void FT(vector<vector<SmartDG::DependencyPort> >& DPIn,
+		vector<vector<SmartDG::DependencyPort> >& DPOut,
+		SmartDG::Dependency &d) {
+	if (SmartDG_TFV)
+		cout << "FT " << d.Name << endl;
+	SmartDG::DependencyDataBuffer &V =
+			*DPOut[d.To.InOutIndex][d.To.PortIndex].DO[d.To.ObjectIndex].Buffer();
+	V.Set(d.FromValue(), Policy::Apply(V.Get(d.ToValue()), V, d.FromValue()));
+}
+
+} /* namespace TransferFunctionsConnector */
+} /* namespace SmartDG */
+
+#endif /* TRANSFERFUNCTIONSCONNECTOR_H_ */
@@ -25,21 +25,15 @@ namespace Instance001 {
 inline void TF(vector<vector<SmartDG::DependencyPort> >& DPIn,
 		vector<vector<SmartDG::DependencyPort> >& DPOut,
 		SmartDG::Dependency &d) {
-	if (SmartDG_TFV)
-		cout << "TF " << d.Name << endl;
-	DPOut[d.To.InOutIndex][d.To.PortIndex].DO[d.To.ObjectIndex].udi[d.From.str].Set(
-			DPIn[d.From.InOutIndex][d.From.PortIndex].DO[d.From.ObjectIndex].udi[d.To.str].Get());
-	d.con->setDirection(1);
+	SmartDG::TransferFunctionsConnector::TF<
+			SmartDG::TransferFunctionsConnector::Ideal>(DPIn, DPOut, d);
 }
 
 inline void FT(vector<vector<SmartDG::DependencyPort> >& DPIn,
 		vector<vector<SmartDG::DependencyPort> >& DPOut,
 		SmartDG::Dependency &d) {
-	if (SmartDG_TFV)
-		cout << "FT " << d.Name << endl;
-	DPIn[d.From.InOutIndex][d.From.PortIndex].DO[d.From.ObjectIndex].udi[d.To.str].Set(
-			DPOut[d.To.InOutIndex][d.To.PortIndex].DO[d.To.ObjectIndex].udi[d.From.str].Get());
-	d.con->setDirection(-1);
+	SmartDG::TransferFunctionsConnector::FT<
+			SmartDG::TransferFunctionsConnector::Ideal>(DPIn, DPOut, d);
 }
 
 } /* namespace Instance001 */
@@ -22,18 +22,21 @@ namespace TransferFunctionsNullNode {
 
 namespace Instance001 {
 
-inline void TFT(string Fun, vector<string> &Return,
-		vector<vector<SmartDG::DependencyPort> >& DP) {
+inline void TF(vector<vector<SmartDG::DependencyPort> >& DP) {
 	if (SmartDG_TFV)
 		cout << "TransferFunctionsNullNode_Instance001" << "SmartComponent "
-				<< " NullNode " << Fun << endl;
-	if (Fun == "List") {
-		Return.push_back(SmartDG_OK);
-		Return.push_back("List");
-		return;
-	}
-	Return.push_back(SmartDG_NOT_OK); // Function Not Found
-	return;
+				<< " NullNode TF" << endl;
+}
+
+inline void FT(vector<vector<SmartDG::DependencyPort> >& DP) {
+	if (SmartDG_TFV)
+		cout << "TransferFunctionsNullNode_Instance001" << "SmartComponent "
+				<< " NullNode FT" << endl;
+}
+
+inline void List(vector<string> &Return) {
+	Return.push_back(SmartDG_OK);
+	Return.push_back("List");
 }
 
 } /* namespace Instance001 */
@@ -14,6 +14,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "SmartDG.h"
+#include <cstdlib>
 
 namespace SmartDG {
 
@@ -22,6 +23,7 @@ URL::URL() {
 	InOutIndex = 0;
 	PortIndex = 0;
 	ObjectIndex = 0;
+	symbol = 0;
 }
 
 URL::URL(unsigned int ni, unsigned int ioi, unsigned int pi, unsigned int oi) {
@@ -29,17 +31,81 @@ URL::URL(unsigned int ni, unsigned int ioi, unsigned int pi, unsigned int oi) {
 	InOutIndex = ioi;
 	PortIndex = pi;
 	ObjectIndex = oi;
+	symbol = 0;
+}
+
+void URL::setNames(string n, string io, string p, string o) {
+	string s = n + "." + io + "." + p + "." + o;
+	lock_guard<mutex> guard(lock);
+	unordered_map<string, unsigned int>::const_iterator it = index.find(s);
+	if (it != index.end()) {
+		symbol = it->second;
+		return;
+	}
+	// Distinct URLs must never share a symbol (their values would alias)
+	if (count == SmartDG_URL_SYMBOL_CHUNK * SmartDG_URL_SYMBOL_CHUNKS) {
+		cout << "ERROR[URL SYMBOL TABLE FULL]: " << s << endl;
+		abort();
+	}
+	// New chunk, published after its strings exist
+	string *chunk = chunks[count / SmartDG_URL_SYMBOL_CHUNK].load();
+	if (chunk == NULL) {
+		chunk = new string[5 * SmartDG_URL_SYMBOL_CHUNK];
+		chunks[count / SmartDG_URL_SYMBOL_CHUNK].store(chunk);
+	}
+	string *names = chunk + 5 * (count % SmartDG_URL_SYMBOL_CHUNK);
+	names[0] = s;
+	names[1] = n;
+	names[2] = io;
+	names[3] = p;
+	names[4] = o;
+	index[s] = count;
+	symbol = count++;
+}
+
+const string &URL::Name(unsigned int symbol, unsigned int part) {
+	static const string empty;
+	if (symbol == 0)
+		return empty;
+	return chunks[symbol / SmartDG_URL_SYMBOL_CHUNK].load()[5
+			* (symbol % SmartDG_URL_SYMBOL_CHUNK) + part];
+}
+
+const string &URL::str() const {
+	return Name(symbol, 0);
+}
+
+const string &URL::strn() const {
+	return Name(symbol, 1);
+}
+
+const string &URL::strio() const {
+	return Name(symbol, 2);
+}
+
+const string &URL::strp() const {
+	return Name(symbol, 3);
+}
+
+const string &URL::stro() const {
+	return Name(symbol, 4);
 }
 
 string URL::dotless(string d) {
-	return (strn + d + strio + d + strp + d + stro);
+	return (strn() + d + strio() + d + strp() + d + stro());
 }
 void URL::Display() {
 	cout << "[" << NodeIndex << "," << InOutIndex << "," << PortIndex << ","
-			<< ObjectIndex << "] " << str << endl;
+			<< ObjectIndex << "] " << str() << endl;
 }
 
-URL::~URL() {
-}
+// Guards index and interning of new symbols
+mutex URL::lock;
+// Symbol for every interned URL::str()
+unordered_map<string, unsigned int> URL::index;
+// Symbol table (chunks are allocated on demand and never freed)
+atomic<string*> URL::chunks[SmartDG_URL_SYMBOL_CHUNKS];
+// Symbol 0 is reserved for empty strings
+unsigned int URL::count = 1;
 
 } /* namespace SmartDG */
@@ -25,24 +25,38 @@ namespace SmartDG {
 ///
 /// This class encapsulates 4 integers and corresponding 4 string identifiers to
 /// Uniquely identify a DependencyObject object deployed at a DependencyPort object
-/// of a DependencyNode object.
+/// of a DependencyNode object.\n
+/// A URL is a 16 byte trivially copyable object: the 4 indexes and a symbol handle.
+/// The string identifiers are interned once per distinct URL in a symbol table shared by all
+/// URL objects (setNames()) and returned by reference on demand (str(), strn(), ...).
+/// Symbol 0 has empty string identifiers.
 ////////////////////////////////////////////////////////////////////////////////
 class URL {
+private:
+	static mutex lock; ///< Guards index and interning of new symbols
+	static unordered_map<string, unsigned int> index; ///< Symbol for every interned URL::str()
+	static atomic<string*> chunks[SmartDG_URL_SYMBOL_CHUNKS]; ///< Symbol table, SmartDG_URL_SYMBOL_CHUNK symbols of 5 strings per chunk
+	static unsigned int count; ///< Number of symbols including symbol 0
+	//////////////////////////////////////////////////
+	/// \fn static const string &Name(unsigned int symbol, unsigned int part)
+	/// \brief Returns string identifier part (0 str, 1 strn, 2 strio, 3 strp, 4 stro) of a symbol
+	///
+	/// - Lock free, symbols are never moved or removed once interned
+	///
+	//////////////////////////////////////////////////
+	static const string &Name(unsigned int symbol, unsigned int part);
 public:
 	unsigned int NodeIndex;	///< Index of current DependencyNode object in DependencyGraph::DN
-	unsigned int InOutIndex;///< 1 of 2 Indexes of current DependencyPort object in DependencyNode::DP (2D Vector)
-	unsigned int PortIndex;	///< 2 of 2 Indexes of current DependencyPort object in DependencyNode::DP (2D Vector)
+	unsigned int InOutIndex :1;///< 1 of 2 Indexes of current DependencyPort object in DependencyNode::DP (2D Vector)
+	unsigned int PortIndex :31;	///< 2 of 2 Indexes of current DependencyPort object in DependencyNode::DP (2D Vector)
 	unsigned int ObjectIndex;///< Index of current DependencyObject object in DependencyPort::DO
-	string str;	///< Complete URL string <URL::strn>.<URL::strio>.<URL::strp>.<URL::stro>
-	string strn;	///< DependencyNode::Name
-	string strio;	///< "In" or "Out"
-	string strp;	///< DependencyPort::Name
-	string stro;	///< DependencyObject::Name
+	unsigned int symbol;	///< Handle of the string identifiers in the symbol table (0 : empty strings)
 	//////////////////////////////////////////////////
 	/// \fn URL()
 	/// \brief Constructor
 	///
-	/// - Sets all 4 index to 0
+	/// - Sets all 4 index to 0\n
+	/// - Sets empty string identifiers
 	///
 	/// \see URL(unsigned int ni, unsigned int ioi, unsigned int pi, unsigned int oi)
 	//////////////////////////////////////////////////
@@ -55,12 +69,51 @@ public:
 	///	\param [in] pi is input PortIndex
 	///	\param [in] oi is input ObjectIndex
 	///
-	/// - Sets all 4 indexes to input values
+	/// - Sets all 4 indexes to input values\n
+	/// - Sets empty string identifiers
 	///
 	/// \see URL()
 	//////////////////////////////////////////////////
 	URL(unsigned int ni, unsigned int ioi, unsigned int pi, unsigned int oi);
 	//////////////////////////////////////////////////
+	/// \fn void setNames(string n, string io, string p, string o)
+	/// \brief Sets the string identifiers, interning them if this URL::str() is new
+	///	\param [in] n is DependencyNode::Name
+	///	\param [in] io is "In" or "Out"
+	///	\param [in] p is DependencyPort::Name
+	///	\param [in] o is DependencyObject::Name
+	///
+	/// - Aborts if the symbol table (SmartDG_URL_SYMBOL_CHUNK * SmartDG_URL_SYMBOL_CHUNKS symbols)
+	/// is full, rather than letting distinct URLs alias one symbol
+	///
+	//////////////////////////////////////////////////
+	void setNames(string n, string io, string p, string o);
+	//////////////////////////////////////////////////
+	/// \fn const string &str() const
+	/// \brief Returns complete URL string <URL::strn()>.<URL::strio()>.<URL::strp()>.<URL::stro()>
+	//////////////////////////////////////////////////
+	const string &str() const;
+	//////////////////////////////////////////////////
+	/// \fn const string &strn() const
+	/// \brief Returns DependencyNode::Name
+	//////////////////////////////////////////////////
+	const string &strn() const;
+	//////////////////////////////////////////////////
+	/// \fn const string &strio() const
+	/// \brief Returns "In" or "Out"
+	//////////////////////////////////////////////////
+	const string &strio() const;
+	//////////////////////////////////////////////////
+	/// \fn const string &strp() const
+	/// \brief Returns DependencyPort::Name
+	//////////////////////////////////////////////////
+	const string &strp() const;
+	//////////////////////////////////////////////////
+	/// \fn const string &stro() const
+	/// \brief Returns DependencyObject::Name
+	//////////////////////////////////////////////////
+	const string &stro() const;
+	//////////////////////////////////////////////////
 	/// \fn string dotless(string d = "x")
 	/// \brief Returns a version of str with all dots replaced by the string d
 	///	\param [in] d is the string that replaces the dot separator (Default value for d is "x").
@@ -78,11 +131,6 @@ public:
 	/// - Displays [<URL::NodeIndex> , <URL::InOutIndex> , <URL::PortIndex> , <URL::ObjectIndex>] <URL::str>
 	//////////////////////////////////////////////////
 	void Display();
-	//////////////////////////////////////////////////
-	/// \fn ~URL()
-	/// \brief Default Destructor
-	//////////////////////////////////////////////////
-	virtual ~URL();
 };
 
 } /* namespace SmartDG */
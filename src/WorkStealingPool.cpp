@@ -0,0 +1,75 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	WorkStealingPool.cpp
+/// \brief	Source file for WorkStealingPool class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+
+WorkStealingPool::WorkStealingPool(unsigned int n) {
+	threads = n;
+	if (threads == 0)
+		threads = std::thread::hardware_concurrency();
+	if (threads == 0)
+		threads = 1;
+}
+
+void WorkStealingPool::Run(vector<function<void()> > &tasks) {
+	unsigned int W = min<unsigned int>(threads, tasks.size());
+	// Runs tasks in the calling thread when only one worker is needed
+	if (W <= 1) {
+		for (unsigned int i = 0; i < tasks.size(); i++)
+			tasks[i]();
+		return;
+	}
+	// Deals tasks round-robin onto one deque per worker
+	vector<deque<unsigned int> > queue(W);
+	vector<mutex> lock(W);
+	for (unsigned int i = 0; i < tasks.size(); i++)
+		queue[i % W].push_back(i);
+	vector<thread> workers;
+	for (unsigned int w = 0; w < W; w++)
+		workers.push_back(thread([&, w]() {
+			while (true) {
+				bool found = false;
+				unsigned int task = 0;
+				// Own deque first (back), then the other deques (front)
+				for (unsigned int k = 0; (k < W) && !found; k++) {
+					unsigned int q = (w + k) % W;
+					lock_guard<mutex> guard(lock[q]);
+					if (queue[q].empty())
+						continue;
+					if (k == 0) {
+						task = queue[q].back();
+						queue[q].pop_back();
+					} else {
+						task = queue[q].front();
+						queue[q].pop_front();
+					}
+					found = true;
+				}
+				// No task is added while running, so empty deques mean the batch is done
+				if (!found)
+					return;
+				tasks[task]();
+			}
+		}));
+	for (unsigned int w = 0; w < W; w++)
+		workers[w].join();
+}
+
+WorkStealingPool::~WorkStealingPool() {
+}
+
+} /* namespace SmartDG */
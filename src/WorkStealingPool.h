@@ -0,0 +1,58 @@
+////////////////////////////////////////////////////////////////////////////////
+///	\file	WorkStealingPool.h
+/// \brief	Header file for WorkStealingPool class
+/// \author Vineet Nagrath
+/// \date	October 17, 2026
+///
+/// \copyright	Service Robotics Research Center\n
+/// University of Applied Sciences Ulm\n
+/// Prittwitzstr. 10\n
+/// 89075 Ulm (Germany)\n
+///
+/// Information about the SmartSoft MDSD Toolchain is available at:\n
+/// www.servicerobotik-ulm.de
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef WORKSTEALINGPOOL_H_
+#define WORKSTEALINGPOOL_H_
+
+#include "SmartDG.h"
+
+namespace SmartDG {
+////////////////////////////////////////////////////////////////////////////////
+///	\class WorkStealingPool
+/// \brief WorkStealingPool class runs a batch of independent tasks on worker threads
+///
+/// Tasks are dealt round-robin onto one deque per worker. A worker takes tasks from the back
+/// of its own deque and, once that is empty, steals from the front of the other deques, so that
+/// workers finishing early take over the remaining work of slower ones.
+/// \see SmartDGGenerator::SolveAll(int direction = 1, unsigned int threads = 0)
+////////////////////////////////////////////////////////////////////////////////
+class WorkStealingPool {
+public:
+	unsigned int threads; ///< Number of worker threads
+	//////////////////////////////////////////////////
+	/// \fn WorkStealingPool(unsigned int n = 0)
+	/// \brief Constructor
+	/// \param [in] n is the number of worker threads (0 : number of hardware threads)
+	//////////////////////////////////////////////////
+	WorkStealingPool(unsigned int n = 0);
+	//////////////////////////////////////////////////
+	/// \fn void Run(vector<function<void()> > &tasks)
+	/// \brief Runs all tasks and returns when they are finished
+	/// \param [in] tasks are the tasks to be run (they must not depend on each other)
+	///
+	/// - Runs tasks in the calling thread when only one worker is needed
+	///
+	//////////////////////////////////////////////////
+	void Run(vector<function<void()> > &tasks);
+	//////////////////////////////////////////////////
+	/// \fn ~WorkStealingPool()
+	/// \brief Default Destructor
+	//////////////////////////////////////////////////
+	virtual ~WorkStealingPool();
+};
+
+} /* namespace SmartDG */
+
+#endif /* WORKSTEALINGPOOL_H_ */